@@ -0,0 +1,292 @@
+#ifndef ALLOCATOR_H
+#define ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+// 单调内存资源（arena）：从大块内存中顺序切分，单次释放不回收，
+// release() 或析构时一次性归还全部内存，适合按请求分配的临时容器
+class MonotonicArena {
+    struct Chunk {
+        Chunk* next;
+        size_t size;
+    };
+
+    Chunk* chunks;              // 自己申请的内存块链表
+    std::byte* cursor;          // 当前块中下一个可用地址
+    std::byte* limit;           // 当前块的末尾
+    std::byte* initial_buffer;  // 用户提供的初始缓冲区（可为空）
+    size_t initial_size;
+    size_t next_chunk_size;
+    size_t used_bytes;
+
+    static constexpr size_t default_chunk_size = 4096;
+
+    void* allocate_from_new_chunk(size_t bytes, size_t alignment) {
+        size_t needed = bytes + alignment + sizeof(Chunk);
+        size_t chunk_size = next_chunk_size;
+        while (chunk_size < needed) {
+            chunk_size *= 2;
+        }
+        auto* chunk = static_cast<Chunk*>(::operator new(chunk_size));
+        chunk->next = chunks;
+        chunk->size = chunk_size;
+        chunks = chunk;
+        cursor = reinterpret_cast<std::byte*>(chunk + 1);
+        limit = reinterpret_cast<std::byte*>(chunk) + chunk_size;
+        next_chunk_size = chunk_size * 2;  // 几何增长，减少块的数量
+        return allocate(bytes, alignment);
+    }
+
+public:
+    explicit MonotonicArena(size_t initial_chunk_size = default_chunk_size) noexcept
+        : chunks(nullptr), cursor(nullptr), limit(nullptr),
+          initial_buffer(nullptr), initial_size(0),
+          next_chunk_size(initial_chunk_size ? initial_chunk_size : default_chunk_size),
+          used_bytes(0) {}
+
+    // 先使用调用者提供的缓冲区（例如栈上数组），用完后再向系统申请
+    MonotonicArena(void* buffer, size_t size) noexcept
+        : chunks(nullptr),
+          cursor(static_cast<std::byte*>(buffer)),
+          limit(static_cast<std::byte*>(buffer) + size),
+          initial_buffer(static_cast<std::byte*>(buffer)), initial_size(size),
+          next_chunk_size(size > default_chunk_size ? size : default_chunk_size),
+          used_bytes(0) {}
+
+    ~MonotonicArena() {
+        release();
+    }
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+        auto current = reinterpret_cast<std::uintptr_t>(cursor);
+        auto aligned = (current + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+        if (cursor == nullptr || aligned + bytes > reinterpret_cast<std::uintptr_t>(limit)) {
+            return allocate_from_new_chunk(bytes, alignment);
+        }
+        cursor = reinterpret_cast<std::byte*>(aligned + bytes);
+        used_bytes += bytes;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    // 单次释放是空操作，内存在 release() 时统一回收
+    void deallocate(void*, size_t, size_t = alignof(std::max_align_t)) noexcept {}
+
+    // 一次性归还全部内存，之前分配出去的指针全部失效
+    void release() noexcept {
+        while (chunks) {
+            Chunk* next = chunks->next;
+            ::operator delete(chunks);
+            chunks = next;
+        }
+        cursor = initial_buffer;
+        limit = initial_buffer ? initial_buffer + initial_size : nullptr;
+        used_bytes = 0;
+    }
+
+    [[nodiscard]] size_t bytes_allocated() const noexcept {
+        return used_bytes;
+    }
+};
+
+// 绑定到 MonotonicArena 的分配器。与 std::pmr 一致，分配器不随容器的
+// 赋值和交换传播，保证容器中的元素始终位于它自己的 arena 中
+template <typename T>
+class ArenaAllocator {
+    template <typename U>
+    friend class ArenaAllocator;
+
+    MonotonicArena* arena;
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+    using is_always_equal = std::false_type;
+
+    explicit ArenaAllocator(MonotonicArena* arena) noexcept : arena(arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+    T* allocate(size_t n) {
+        if (n > static_cast<size_t>(-1) / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        arena->deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    [[nodiscard]] MonotonicArena* resource() const noexcept {
+        return arena;
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return arena == other.arena;
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept {
+        return arena != other.arena;
+    }
+};
+
+// 按大小分级的内存池：16 字节到 4096 字节共 9 个级别，每级维护一条空闲链表，
+// 空闲链表耗尽时整块申请 slab 再切分。超出范围或对齐要求过高的请求直接走
+// operator new。不是线程安全的，应当按线程或按请求持有
+class SizeClassPool {
+    struct FreeNode {
+        FreeNode* next;
+    };
+    struct Slab {
+        Slab* next;
+    };
+
+    static constexpr size_t min_class_shift = 4;   // 16 字节
+    static constexpr size_t max_class_shift = 12;  // 4096 字节
+    static constexpr size_t class_count = max_class_shift - min_class_shift + 1;
+    static constexpr size_t slab_size = 64 * 1024;
+    static constexpr size_t block_alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+    // slab 头部按块对齐填充，保证切出来的块满足 block_alignment
+    static constexpr size_t slab_header = (sizeof(Slab) + block_alignment - 1) / block_alignment * block_alignment;
+
+    FreeNode* free_lists[class_count];
+    Slab* slabs;
+
+    static size_t size_class(size_t bytes) noexcept {
+        size_t index = 0;
+        size_t class_size = size_t(1) << min_class_shift;
+        while (class_size < bytes) {
+            class_size <<= 1;
+            ++index;
+        }
+        return index;
+    }
+
+    static bool fits_in_pool(size_t bytes, size_t alignment) noexcept {
+        return bytes <= (size_t(1) << max_class_shift) && alignment <= block_alignment;
+    }
+
+    void refill(size_t index) {
+        size_t block_size = size_t(1) << (index + min_class_shift);
+        auto* raw = static_cast<std::byte*>(::operator new(slab_size));
+        auto* slab = reinterpret_cast<Slab*>(raw);
+        slab->next = slabs;
+        slabs = slab;
+        // 把整个 slab 切成块并按地址顺序串到空闲链表上
+        size_t count = (slab_size - slab_header) / block_size;
+        FreeNode* head = free_lists[index];
+        for (size_t i = count; i > 0; --i) {
+            auto* node = reinterpret_cast<FreeNode*>(raw + slab_header + (i - 1) * block_size);
+            node->next = head;
+            head = node;
+        }
+        free_lists[index] = head;
+    }
+
+public:
+    SizeClassPool() noexcept : free_lists{}, slabs(nullptr) {}
+
+    ~SizeClassPool() {
+        release();
+    }
+
+    SizeClassPool(const SizeClassPool&) = delete;
+    SizeClassPool& operator=(const SizeClassPool&) = delete;
+
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+        if (!fits_in_pool(bytes, alignment)) {
+            return ::operator new(bytes, std::align_val_t(alignment));
+        }
+        size_t index = size_class(bytes);
+        if (!free_lists[index]) {
+            refill(index);
+        }
+        FreeNode* node = free_lists[index];
+        free_lists[index] = node->next;
+        return node;
+    }
+
+    void deallocate(void* p, size_t bytes, size_t alignment = alignof(std::max_align_t)) noexcept {
+        if (!p) return;
+        if (!fits_in_pool(bytes, alignment)) {
+            ::operator delete(p, std::align_val_t(alignment));
+            return;
+        }
+        size_t index = size_class(bytes);
+        auto* node = static_cast<FreeNode*>(p);
+        node->next = free_lists[index];
+        free_lists[index] = node;
+    }
+
+    // 一次性归还所有 slab，池中分配出去的指针全部失效
+    void release() noexcept {
+        while (slabs) {
+            Slab* next = slabs->next;
+            ::operator delete(slabs);
+            slabs = next;
+        }
+        for (auto& list : free_lists) {
+            list = nullptr;
+        }
+    }
+};
+
+// 绑定到 SizeClassPool 的分配器，传播语义与 ArenaAllocator 相同
+template <typename T>
+class PoolAllocator {
+    template <typename U>
+    friend class PoolAllocator;
+
+    SizeClassPool* pool;
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+    using is_always_equal = std::false_type;
+
+    explicit PoolAllocator(SizeClassPool* pool) noexcept : pool(pool) {}
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept : pool(other.pool) {}
+
+    T* allocate(size_t n) {
+        if (n > static_cast<size_t>(-1) / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(pool->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        pool->deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    [[nodiscard]] SizeClassPool* resource() const noexcept {
+        return pool;
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>& other) const noexcept {
+        return pool == other.pool;
+    }
+
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>& other) const noexcept {
+        return pool != other.pool;
+    }
+};
+
+#endif // ALLOCATOR_H
@@ -0,0 +1,202 @@
+#ifndef ATOMIC_SHARED_PTR_H
+#define ATOMIC_SHARED_PTR_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include "shared_ptr.hpp"
+
+// Lock-free atomic holder for a shared_ptr, for snapshots that are read on every request
+// and replaced rarely. Implemented with split reference counting:
+//
+// The stored value lives in a heap Node. The atomic word packs the Node address into the
+// low 48 bits and a "local" count of in-flight readers into the high 16 bits. A reader
+// increments the local count with one fetch_add, copies the shared_ptr out of the Node,
+// then gives its borrow back: by decrementing the local count if the same Node is still
+// installed, or by decrementing Node::refs if a writer has swapped the Node out meanwhile.
+// A writer that swaps a Node out adds the local count it removed to Node::refs. Node::refs
+// may go negative while readers race the writer, and the Node is freed when it returns to
+// zero, after the last borrower is done with it.
+//
+// Readers never block and never allocate; store/exchange allocate one Node per value.
+// Every operation uses acq_rel ordering (seq_cst for the word), whatever order is passed.
+// Requires user-space addresses to fit in 48 bits, as on x86-64 and AArch64 Linux.
+template <typename T>
+class atomic_shared_ptr {
+    struct Node {
+        shared_ptr<T> value;
+        std::atomic<std::ptrdiff_t> refs{0};  // transferred borrows minus returned ones
+
+        explicit Node(shared_ptr<T>&& v) noexcept : value(std::move(v)) {}
+    };
+
+    static constexpr unsigned count_shift = 48;
+    static constexpr uintptr_t count_one = uintptr_t(1) << count_shift;
+    static constexpr uintptr_t pointer_mask = count_one - 1;
+    static_assert(sizeof(uintptr_t) == 8, "atomic_shared_ptr packs a pointer and a count into 64 bits");
+
+    mutable std::atomic<uintptr_t> word;
+
+    static Node* node_of(uintptr_t w) noexcept { return reinterpret_cast<Node*>(w & pointer_mask); }
+    static uintptr_t count_of(uintptr_t w) noexcept { return w >> count_shift; }
+    static Node* make_node(shared_ptr<T>&& value);
+    static bool same_value(const shared_ptr<T>& a, const shared_ptr<T>& b) noexcept;
+
+    // Registers the caller as a reader of the installed Node and returns the word it saw
+    uintptr_t borrow() const noexcept;
+    // Returns a borrow taken by borrow()
+    void unborrow(uintptr_t borrowed) const noexcept;
+    // Hands the local count of a swapped-out word, minus the caller's own borrows, to its Node
+    static void retire(uintptr_t old, uintptr_t own_borrows) noexcept;
+    static void release_node(Node* node, std::ptrdiff_t delta) noexcept;
+public:
+    // Constructors
+    atomic_shared_ptr() noexcept : word(0) {}
+    explicit atomic_shared_ptr(shared_ptr<T> desired);
+    atomic_shared_ptr(const atomic_shared_ptr&) = delete;
+    atomic_shared_ptr& operator=(const atomic_shared_ptr&) = delete;
+    // Destructor
+    ~atomic_shared_ptr();
+
+    static constexpr bool is_always_lock_free = std::atomic<uintptr_t>::is_always_lock_free;
+    [[nodiscard]] bool is_lock_free() const noexcept { return word.is_lock_free(); }
+
+    // Atomic operations
+    shared_ptr<T> load(std::memory_order order = std::memory_order_seq_cst) const noexcept;
+    void store(shared_ptr<T> desired, std::memory_order order = std::memory_order_seq_cst);
+    shared_ptr<T> exchange(shared_ptr<T> desired, std::memory_order order = std::memory_order_seq_cst);
+    // Succeeds if the stored value owns the same object through the same control block as
+    // expected; otherwise expected is replaced by the stored value
+    bool compare_exchange_strong(shared_ptr<T>& expected, shared_ptr<T> desired,
+                                 std::memory_order order = std::memory_order_seq_cst);
+    bool compare_exchange_weak(shared_ptr<T>& expected, shared_ptr<T> desired,
+                               std::memory_order order = std::memory_order_seq_cst);
+
+    operator shared_ptr<T>() const noexcept { return load(); }
+    atomic_shared_ptr& operator=(shared_ptr<T> desired);
+};
+
+template <typename T>
+typename atomic_shared_ptr<T>::Node* atomic_shared_ptr<T>::make_node(shared_ptr<T>&& value) {
+    // An empty pointer is represented by a null word, so storing it never allocates
+    return value.control_block ? new Node(std::move(value)) : nullptr;
+}
+
+template <typename T>
+bool atomic_shared_ptr<T>::same_value(const shared_ptr<T>& a, const shared_ptr<T>& b) noexcept {
+    return a.control_block == b.control_block && a.ptr == b.ptr;
+}
+
+template <typename T>
+uintptr_t atomic_shared_ptr<T>::borrow() const noexcept {
+    return word.fetch_add(count_one, std::memory_order_acq_rel) + count_one;
+}
+
+template <typename T>
+void atomic_shared_ptr<T>::unborrow(uintptr_t borrowed) const noexcept {
+    // A null word has no Node to protect; its count is never read
+    if (!node_of(borrowed)) return;
+    uintptr_t current = word.load(std::memory_order_relaxed);
+    while ((current & pointer_mask) == (borrowed & pointer_mask)) {
+        if (word.compare_exchange_weak(current, current - count_one, std::memory_order_acq_rel,
+                                       std::memory_order_relaxed)) {
+            return;
+        }
+    }
+    // The Node was swapped out and the writer moved our borrow into Node::refs.
+    // It cannot have been freed and reused at the same address while we held the borrow.
+    release_node(node_of(borrowed), -1);
+}
+
+template <typename T>
+void atomic_shared_ptr<T>::retire(uintptr_t old, uintptr_t own_borrows) noexcept {
+    if (Node* node = node_of(old)) {
+        release_node(node, static_cast<std::ptrdiff_t>(count_of(old) - own_borrows));
+    }
+}
+
+template <typename T>
+void atomic_shared_ptr<T>::release_node(Node* node, std::ptrdiff_t delta) noexcept {
+    if (node->refs.fetch_add(delta, std::memory_order_acq_rel) + delta == 0) {
+        delete node;
+    }
+}
+
+// Constructor and destructor
+template <typename T>
+atomic_shared_ptr<T>::atomic_shared_ptr(shared_ptr<T> desired)
+    : word(reinterpret_cast<uintptr_t>(make_node(std::move(desired)))) {}
+
+template <typename T>
+atomic_shared_ptr<T>::~atomic_shared_ptr() {
+    delete node_of(word.load(std::memory_order_acquire));
+}
+
+// Atomic operations
+template <typename T>
+shared_ptr<T> atomic_shared_ptr<T>::load(std::memory_order) const noexcept {
+    uintptr_t borrowed = borrow();
+    Node* node = node_of(borrowed);
+    shared_ptr<T> result = node ? node->value : shared_ptr<T>();
+    unborrow(borrowed);
+    return result;
+}
+
+template <typename T>
+void atomic_shared_ptr<T>::store(shared_ptr<T> desired, std::memory_order order) {
+    exchange(std::move(desired), order);
+}
+
+template <typename T>
+shared_ptr<T> atomic_shared_ptr<T>::exchange(shared_ptr<T> desired, std::memory_order) {
+    Node* fresh = make_node(std::move(desired));
+    uintptr_t old = word.exchange(reinterpret_cast<uintptr_t>(fresh), std::memory_order_acq_rel);
+    Node* node = node_of(old);
+    // Readers may still be copying node->value, so copy rather than move it out
+    shared_ptr<T> result = node ? node->value : shared_ptr<T>();
+    retire(old, 0);
+    return result;
+}
+
+template <typename T>
+bool atomic_shared_ptr<T>::compare_exchange_strong(shared_ptr<T>& expected, shared_ptr<T> desired,
+                                                   std::memory_order) {
+    Node* fresh = make_node(std::move(desired));
+    while (true) {
+        uintptr_t borrowed = borrow();
+        Node* node = node_of(borrowed);
+        bool equal = node ? same_value(node->value, expected) : !expected.control_block;
+        if (!equal) {
+            expected = node ? node->value : shared_ptr<T>();
+            unborrow(borrowed);
+            delete fresh;
+            return false;
+        }
+        uintptr_t current = borrowed;
+        while (node_of(current) == node) {
+            if (word.compare_exchange_weak(current, reinterpret_cast<uintptr_t>(fresh), std::memory_order_acq_rel,
+                                           std::memory_order_relaxed)) {
+                // The local count of the replaced word includes our own borrow
+                retire(current, 1);
+                return true;
+            }
+        }
+        // Another writer got in between; compare against the new value
+        unborrow(borrowed);
+    }
+}
+
+template <typename T>
+bool atomic_shared_ptr<T>::compare_exchange_weak(shared_ptr<T>& expected, shared_ptr<T> desired,
+                                                 std::memory_order order) {
+    return compare_exchange_strong(expected, std::move(desired), order);
+}
+
+template <typename T>
+atomic_shared_ptr<T>& atomic_shared_ptr<T>::operator=(shared_ptr<T> desired) {
+    store(std::move(desired));
+    return *this;
+}
+
+#endif // ATOMIC_SHARED_PTR_H
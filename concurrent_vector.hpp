@@ -0,0 +1,260 @@
+#ifndef CONCURRENT_VECTOR_H
+#define CONCURRENT_VECTOR_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+// 并发追加向量：元素存放在按几何级数增长的分段中，分段一旦分配就不再移动，
+// 因此元素地址在整个生命周期内稳定。push_back/emplace_back/grow_by 无锁且可以并发调用，
+// 返回新元素的下标；已经构造完成的元素可以被其他线程并发读取。
+//
+// 下标 i 的定位：令 j = i + B（B 为首段大小），段号 k = bit_width(j) - 1 - log2(B)，
+// 段内偏移 j - (B << k)。第 k 段容纳 B * 2^k 个元素
+template <typename T, typename Alloc = std::allocator<T>>
+class ConcurrentVector {
+    using alloc_traits = std::allocator_traits<Alloc>;
+    using state_type = std::atomic<unsigned char>;
+
+    static constexpr size_t first_segment_size = 8;
+    static constexpr size_t first_segment_shift = std::countr_zero(first_segment_size);
+    static constexpr size_t max_segments = sizeof(size_t) * 8 - first_segment_shift;
+
+    // 每段是一次分配：前面是元素，后面紧跟每个元素一个的状态字节，
+    // 0 表示尚未构造（或构造失败），1 表示已可读取
+    std::atomic<T*> segments[max_segments];
+    std::atomic<size_t> reserved;  // 已经分配出去的下标数
+    [[no_unique_address]] Alloc allocator;
+
+    static constexpr size_t segment_index(size_t index) noexcept {
+        return std::bit_width(index + first_segment_size) - 1 - first_segment_shift;
+    }
+    static constexpr size_t segment_base(size_t k) noexcept {
+        return (first_segment_size << k) - first_segment_size;
+    }
+    static constexpr size_t segment_size(size_t k) noexcept {
+        return first_segment_size << k;
+    }
+    // 一段实际占用的 T 个数：元素之后追加足够容纳状态字节的空间
+    static constexpr size_t segment_allocation(size_t k) noexcept {
+        return segment_size(k) + (segment_size(k) + sizeof(T) - 1) / sizeof(T);
+    }
+    static state_type* segment_states(T* segment, size_t k) noexcept {
+        return reinterpret_cast<state_type*>(segment + segment_size(k));
+    }
+
+    // 取得第 k 段，不存在时分配；多个线程同时分配时只有一个胜出，其余释放自己的分段
+    T* ensure_segment(size_t k);
+    // 定位下标为 index 的元素及其状态字节，调用前该段必须已经分配
+    std::pair<T*, state_type*> locate(size_t index) const noexcept;
+    // 在已预留的下标上构造元素并发布
+    template <typename... Args>
+    void construct_at(size_t index, Args&&... args);
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    // 构造函数声明
+    ConcurrentVector() noexcept(noexcept(Alloc()));
+    explicit ConcurrentVector(const Alloc& alloc) noexcept;
+    ConcurrentVector(const ConcurrentVector&) = delete;
+    ConcurrentVector& operator=(const ConcurrentVector&) = delete;
+    // 析构函数声明
+    ~ConcurrentVector();
+    // 添加元素函数声明，返回新元素的下标，可以并发调用
+    size_t push_back(const T& value);
+    size_t push_back(T&& value);
+    template <typename... Args>
+    size_t emplace_back(Args&&... args);
+    // 一次性预留 n 个连续下标并构造元素，返回第一个下标
+    size_t grow_by(size_t n);
+    size_t grow_by(size_t n, const T& value);
+    // 访问元素函数声明：下标必须来自已经返回的 push_back/grow_by，
+    // 或先用 is_ready 确认元素已经构造完成
+    T& operator[](size_t index);
+    const T& operator[](size_t index) const;
+    // 带检查的访问：越界或元素尚未构造完成时抛出 std::out_of_range
+    T& at(size_t index);
+    const T& at(size_t index) const;
+    [[nodiscard]] bool is_ready(size_t index) const noexcept;
+    // 已预留的下标数，其中可能包含其他线程正在构造的元素
+    [[nodiscard]] size_t size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+    // 清空，不能与其他操作并发
+    void clear() noexcept;
+    allocator_type get_allocator() const noexcept;
+};
+
+template <typename T, typename Alloc>
+T* ConcurrentVector<T, Alloc>::ensure_segment(size_t k) {
+    T* segment = segments[k].load(std::memory_order_acquire);
+    if (segment) return segment;
+
+    T* fresh = alloc_traits::allocate(allocator, segment_allocation(k));
+    state_type* states = segment_states(fresh, k);
+    for (size_t i = 0; i < segment_size(k); ++i) {
+        ::new (static_cast<void*>(states + i)) state_type(0);
+    }
+    if (segments[k].compare_exchange_strong(segment, fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        return fresh;
+    }
+    // 其他线程抢先发布了这一段
+    alloc_traits::deallocate(allocator, fresh, segment_allocation(k));
+    return segment;
+}
+
+template <typename T, typename Alloc>
+std::pair<T*, typename ConcurrentVector<T, Alloc>::state_type*>
+ConcurrentVector<T, Alloc>::locate(size_t index) const noexcept {
+    size_t k = segment_index(index);
+    size_t offset = index - segment_base(k);
+    T* segment = segments[k].load(std::memory_order_acquire);
+    return {segment + offset, segment_states(segment, k) + offset};
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+void ConcurrentVector<T, Alloc>::construct_at(size_t index, Args&&... args) {
+    ensure_segment(segment_index(index));
+    auto [element, state] = locate(index);
+    // 构造失败时状态保持 0，该下标被永久跳过，析构时也不会销毁它
+    alloc_traits::construct(allocator, element, std::forward<Args>(args)...);
+    state->store(1, std::memory_order_release);
+}
+
+// 构造函数实现
+template <typename T, typename Alloc>
+ConcurrentVector<T, Alloc>::ConcurrentVector() noexcept(noexcept(Alloc()))
+    : segments{}, reserved(0), allocator() {}
+
+template <typename T, typename Alloc>
+ConcurrentVector<T, Alloc>::ConcurrentVector(const Alloc& alloc) noexcept
+    : segments{}, reserved(0), allocator(alloc) {}
+
+// 析构函数实现
+template <typename T, typename Alloc>
+ConcurrentVector<T, Alloc>::~ConcurrentVector() {
+    clear();
+}
+
+// 添加元素函数实现
+template <typename T, typename Alloc>
+size_t ConcurrentVector<T, Alloc>::push_back(const T& value) {
+    return emplace_back(value);
+}
+
+template <typename T, typename Alloc>
+size_t ConcurrentVector<T, Alloc>::push_back(T&& value) {
+    return emplace_back(std::move(value));
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+size_t ConcurrentVector<T, Alloc>::emplace_back(Args&&... args) {
+    size_t index = reserved.fetch_add(1, std::memory_order_relaxed);
+    construct_at(index, std::forward<Args>(args)...);
+    return index;
+}
+
+template <typename T, typename Alloc>
+size_t ConcurrentVector<T, Alloc>::grow_by(size_t n) {
+    size_t first = reserved.fetch_add(n, std::memory_order_relaxed);
+    if (n == 0) return first;
+    // 先分配覆盖整个区间的所有分段，再逐个构造
+    for (size_t k = segment_index(first); k <= segment_index(first + n - 1); ++k) {
+        ensure_segment(k);
+    }
+    for (size_t i = first; i < first + n; ++i) {
+        construct_at(i);
+    }
+    return first;
+}
+
+template <typename T, typename Alloc>
+size_t ConcurrentVector<T, Alloc>::grow_by(size_t n, const T& value) {
+    size_t first = reserved.fetch_add(n, std::memory_order_relaxed);
+    if (n == 0) return first;
+    for (size_t k = segment_index(first); k <= segment_index(first + n - 1); ++k) {
+        ensure_segment(k);
+    }
+    for (size_t i = first; i < first + n; ++i) {
+        construct_at(i, value);
+    }
+    return first;
+}
+
+// 访问元素函数实现
+template <typename T, typename Alloc>
+T& ConcurrentVector<T, Alloc>::operator[](size_t index) {
+    return *locate(index).first;
+}
+
+template <typename T, typename Alloc>
+const T& ConcurrentVector<T, Alloc>::operator[](size_t index) const {
+    return *locate(index).first;
+}
+
+template <typename T, typename Alloc>
+T& ConcurrentVector<T, Alloc>::at(size_t index) {
+    if (!is_ready(index)) {
+        throw std::out_of_range("ConcurrentVector::at");
+    }
+    return *locate(index).first;
+}
+
+template <typename T, typename Alloc>
+const T& ConcurrentVector<T, Alloc>::at(size_t index) const {
+    if (!is_ready(index)) {
+        throw std::out_of_range("ConcurrentVector::at");
+    }
+    return *locate(index).first;
+}
+
+template <typename T, typename Alloc>
+bool ConcurrentVector<T, Alloc>::is_ready(size_t index) const noexcept {
+    if (index >= reserved.load(std::memory_order_acquire)) return false;
+    size_t k = segment_index(index);
+    T* segment = segments[k].load(std::memory_order_acquire);
+    if (!segment) return false;
+    return segment_states(segment, k)[index - segment_base(k)].load(std::memory_order_acquire) == 1;
+}
+
+// 容量和大小函数实现
+template <typename T, typename Alloc>
+size_t ConcurrentVector<T, Alloc>::size() const noexcept {
+    return reserved.load(std::memory_order_acquire);
+}
+
+template <typename T, typename Alloc>
+bool ConcurrentVector<T, Alloc>::empty() const noexcept {
+    return size() == 0;
+}
+
+// 清空函数实现：只销毁构造成功的元素
+template <typename T, typename Alloc>
+void ConcurrentVector<T, Alloc>::clear() noexcept {
+    for (size_t k = 0; k < max_segments; ++k) {
+        T* segment = segments[k].load(std::memory_order_acquire);
+        if (!segment) continue;
+        state_type* states = segment_states(segment, k);
+        for (size_t i = 0; i < segment_size(k); ++i) {
+            if (states[i].load(std::memory_order_relaxed) == 1) {
+                alloc_traits::destroy(allocator, segment + i);
+            }
+        }
+        alloc_traits::deallocate(allocator, segment, segment_allocation(k));
+        segments[k].store(nullptr, std::memory_order_relaxed);
+    }
+    reserved.store(0, std::memory_order_relaxed);
+}
+
+template <typename T, typename Alloc>
+typename ConcurrentVector<T, Alloc>::allocator_type ConcurrentVector<T, Alloc>::get_allocator() const noexcept {
+    return allocator;
+}
+
+#endif // CONCURRENT_VECTOR_H
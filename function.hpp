@@ -1,75 +1,387 @@
 #pragma once
 #include <memory>
+#include <new>
+#include <cstddef>
+#include <cstring>
+#include <exception>
 #include <utility>
 #include <type_traits>
 #include <functional>
 
+// 内联缓冲区大小（字节），不超过该大小且可以 noexcept 移动的可调用对象直接存放在 Function 内部，
+// 不再分配堆内存。默认 3 个指针，足够容纳捕获两三个指针/引用的 lambda
+#ifndef MYSTL_FUNCTION_INLINE_SIZE
+#define MYSTL_FUNCTION_INLINE_SIZE (3 * sizeof(void*))
+#endif
+
+namespace function_detail {
+
+constexpr size_t inline_size = MYSTL_FUNCTION_INLINE_SIZE;
+constexpr size_t inline_align = alignof(std::max_align_t);
+
+// 可调用对象的存储：要么内联在 buffer 中，要么是指向堆上对象的指针
+union Storage {
+    void* heap;
+    alignas(inline_align) unsigned char buffer[inline_size < sizeof(void*) ? sizeof(void*) : inline_size];
+};
+
+// 内联存放要求 noexcept 移动，这样 Function 自身的移动永远不会抛出
+template <typename F>
+constexpr bool stored_inline = sizeof(F) <= sizeof(Storage) && alignof(F) <= inline_align &&
+                               std::is_nothrow_move_constructible_v<F>;
+
+// 可以按字节搬运和复制的内联对象：移动、销毁、拷贝都不需要经过函数指针
+template <typename F>
+constexpr bool trivially_stored = stored_inline<F> && std::is_trivially_copyable_v<F>;
+
+template <typename F>
+F* target(Storage& storage) noexcept {
+    if constexpr (stored_inline<F>) {
+        return std::launder(reinterpret_cast<F*>(storage.buffer));
+    } else {
+        return static_cast<F*>(storage.heap);
+    }
+}
+
+template <typename F>
+const F* target(const Storage& storage) noexcept {
+    return target<F>(const_cast<Storage&>(storage));
+}
+
+// 手写的虚表：每种可调用类型一份静态实例。move/destroy/clone 为空表示按字节处理即可
+// （堆上对象的移动只是指针拷贝，平凡类型的内联对象直接 memcpy）
+template <typename Invoker>
+struct VTable {
+    Invoker* invoke;
+    void (*move)(Storage& dst, Storage& src) noexcept;  // 移动构造到 dst 并销毁 src
+    void (*destroy)(Storage& storage) noexcept;
+    void (*clone)(Storage& dst, const Storage& src);
+};
+
+template <typename F, typename... Args>
+void construct(Storage& storage, Args&&... args) {
+    if constexpr (stored_inline<F>) {
+        ::new (static_cast<void*>(storage.buffer)) F(std::forward<Args>(args)...);
+    } else {
+        storage.heap = new F(std::forward<Args>(args)...);
+    }
+}
+
+template <typename F>
+void move_inline(Storage& dst, Storage& src) noexcept {
+    F* source = target<F>(src);
+    ::new (static_cast<void*>(dst.buffer)) F(std::move(*source));
+    source->~F();
+}
+
+template <typename F>
+void destroy(Storage& storage) noexcept {
+    if constexpr (stored_inline<F>) {
+        target<F>(storage)->~F();
+    } else {
+        delete target<F>(storage);
+    }
+}
+
+template <typename F>
+void clone(Storage& dst, const Storage& src) {
+    construct<F>(dst, *target<F>(src));
+}
+
+template <typename F, typename Invoker, bool Copyable>
+constexpr VTable<Invoker> make_vtable(Invoker* invoke) noexcept {
+    VTable<Invoker> table{invoke, nullptr, nullptr, nullptr};
+    if constexpr (!trivially_stored<F>) {
+        table.destroy = &destroy<F>;
+        if constexpr (stored_inline<F>) {
+            table.move = &move_inline<F>;
+        }
+    }
+    if constexpr (Copyable && !trivially_stored<F>) {
+        table.clone = &clone<F>;
+    }
+    return table;
+}
+
+// 空函数指针、空成员指针构造出空的 Function
+template <typename F>
+bool is_null(const F& f) noexcept {
+    if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>) {
+        return f == nullptr;
+    } else {
+        return false;
+    }
+}
+
+} // namespace function_detail
+
 template <typename>
-class Function; 
+class Function;
 
 //模板特化，R(Args...)表示一个可调用对象，R是返回类型，Args...是参数类型
 template <typename R, typename... Args>
 class Function<R(Args...)> {
-    //ICallable是一个抽象类，定义了一个纯虚函数invoke，用于包裹可调用对象
-    class ICallable {
-    public:
-        virtual R invoke(Args&&... args) = 0;
-        virtual std::unique_ptr<ICallable> clone() const = 0;
-        virtual ~ICallable() = default;
-    };
-
-    //CallableImpl是一个具体类，继承自ICallable，用于包裹可调用对象
+    using Invoker = R(function_detail::Storage&, Args&&...);
+    using VTable = function_detail::VTable<Invoker>;
+
     template <typename F>
-    class CallableImpl : public ICallable {
-        F func;
-    public:
-        explicit CallableImpl(F&& f) : func(std::forward<F>(f)) {}
-        
-        R invoke(Args&&... args) override {
-            // return func(std::forward<Args>(args)...);
-            return std::invoke(func, std::forward<Args>(args)...);
+    static R invoke(function_detail::Storage& storage, Args&&... args) {
+        if constexpr (std::is_void_v<R>) {
+            std::invoke(*function_detail::target<F>(storage), std::forward<Args>(args)...);
+        } else {
+            return std::invoke(*function_detail::target<F>(storage), std::forward<Args>(args)...);
         }
-        
-        std::unique_ptr<ICallable> clone() const override {
-            return std::make_unique<CallableImpl<F>>(F(func));
+    }
+
+    template <typename F>
+    static constexpr VTable vtable_for = function_detail::make_vtable<F, Invoker, true>(&invoke<F>);
+
+    //storage保存可调用对象本身，vtable指向该类型的操作表，为空表示没有可调用对象
+    mutable function_detail::Storage storage;
+    const VTable* vtable = nullptr;
+
+    void reset() noexcept {
+        if (vtable && vtable->destroy) {
+            vtable->destroy(storage);
         }
-    };
+        vtable = nullptr;
+    }
 
-    std::unique_ptr<ICallable> callable;
+    void move_from(Function& other) noexcept {
+        vtable = other.vtable;
+        if (vtable) {
+            if (vtable->move) {
+                vtable->move(storage, other.storage);
+            } else {
+                std::memcpy(&storage, &other.storage, sizeof(storage));
+            }
+            other.vtable = nullptr;
+        }
+    }
 
 public:
     // 默认构造函数
     Function() noexcept = default;
-    
-    template <typename F, typename = std::enable_if_t<!std::is_same<std::decay_t<F>, Function>::value>>
-    //构造函数，接受一个可调用对象F，并将其包裹在CallableImpl中
-    Function(F&& f)
-        : callable(std::make_unique<CallableImpl<std::decay_t<F>>>(std::forward<F>(f))) {}
+    Function(std::nullptr_t) noexcept {}
+
+    //构造函数，接受一个可调用对象F；小对象放进内联缓冲区，否则在堆上分配
+    template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Function> &&
+                                                      std::is_copy_constructible_v<std::decay_t<F>> &&
+                                                      std::is_invocable_r_v<R, std::decay_t<F>&, Args...>>>
+    Function(F&& f) {
+        using Fn = std::decay_t<F>;
+        if (function_detail::is_null(f)) return;
+        function_detail::construct<Fn>(storage, std::forward<F>(f));
+        vtable = &vtable_for<Fn>;
+    }
 
     // 移动构造和赋值
-    Function(Function&& other) noexcept = default;
-    Function& operator=(Function&& other) noexcept = default;
+    Function(Function&& other) noexcept {
+        move_from(other);
+    }
+    Function& operator=(Function&& other) noexcept {
+        if (this != &other) {
+            reset();
+            move_from(other);
+        }
+        return *this;
+    }
 
     // 拷贝构造函数
-    Function(const Function& other) 
-        : callable(other.callable ? other.callable->clone() : nullptr) {}
-    
+    Function(const Function& other) : vtable(other.vtable) {
+        if (vtable) {
+            if (vtable->clone) {
+                vtable->clone(storage, other.storage);
+            } else {
+                std::memcpy(&storage, &other.storage, sizeof(storage));
+            }
+        }
+    }
+
     // 拷贝赋值运算符
     Function& operator=(const Function& other) {
         if (this != &other) {
-            callable = other.callable ? other.callable->clone() : nullptr;
+            Function copy(other);
+            reset();
+            move_from(copy);
         }
         return *this;
     }
 
-    R operator()(Args... args) {
-        if (!callable) {
+    Function& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    ~Function() {
+        reset();
+    }
+
+    R operator()(Args... args) const {
+        if (!vtable) {
             throw std::bad_function_call();
         }
-        return callable->invoke(std::forward<Args>(args)...);
+        return vtable->invoke(storage, std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const noexcept {
+        return vtable != nullptr;
+    }
+
+    void swap(Function& other) noexcept {
+        Function tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+};
+
+namespace function_detail {
+
+// MoveOnlyFunction 的公共实现。Const 为 true 时可调用对象以 const 方式调用、operator() 为 const；
+// Noexcept 为 true 时要求可调用对象不抛异常、operator() 为 noexcept。
+// 与 Function 共用内联存储和手写虚表，但不要求可调用对象可拷贝，虚表中没有 clone
+template <typename R, bool Const, bool Noexcept, typename... Args>
+class MoveOnlyFunctionImpl {
+    using Invoker = R(Storage&, Args&&...);
+    using Table = VTable<Invoker>;
+
+    template <typename F>
+    using callee_type = std::conditional_t<Const, const F&, F&>;
+
+    template <typename F>
+    static constexpr bool callable = Noexcept ? std::is_nothrow_invocable_r_v<R, callee_type<F>, Args...>
+                                              : std::is_invocable_r_v<R, callee_type<F>, Args...>;
+
+    template <typename F>
+    static R invoke(Storage& storage, Args&&... args) {
+        callee_type<F> f = *target<F>(storage);
+        if constexpr (std::is_void_v<R>) {
+            std::invoke(f, std::forward<Args>(args)...);
+        } else {
+            return std::invoke(f, std::forward<Args>(args)...);
+        }
+    }
+
+    template <typename F>
+    static constexpr Table vtable_for = make_vtable<F, Invoker, false>(&invoke<F>);
+
+    mutable Storage storage;
+    const Table* vtable = nullptr;
+
+    void reset() noexcept {
+        if (vtable && vtable->destroy) {
+            vtable->destroy(storage);
+        }
+        vtable = nullptr;
+    }
+
+    void move_from(MoveOnlyFunctionImpl& other) noexcept {
+        vtable = other.vtable;
+        if (vtable) {
+            if (vtable->move) {
+                vtable->move(storage, other.storage);
+            } else {
+                std::memcpy(&storage, &other.storage, sizeof(storage));
+            }
+            other.vtable = nullptr;
+        }
+    }
+
+    R call(Args&&... args) const noexcept(Noexcept) {
+        if (!vtable) {
+            // noexcept 签名无法抛出异常，空调用直接终止
+            if constexpr (Noexcept) {
+                std::terminate();
+            } else {
+                throw std::bad_function_call();
+            }
+        }
+        return vtable->invoke(storage, std::forward<Args>(args)...);
+    }
+
+public:
+    // 默认构造函数
+    MoveOnlyFunctionImpl() noexcept = default;
+    MoveOnlyFunctionImpl(std::nullptr_t) noexcept {}
+
+    //构造函数，接受一个可调用对象F（可以只能移动）；小对象放进内联缓冲区，否则在堆上分配
+    template <typename F, typename = std::enable_if_t<!std::is_base_of_v<MoveOnlyFunctionImpl, std::decay_t<F>> &&
+                                                      std::is_constructible_v<std::decay_t<F>, F> &&
+                                                      callable<std::decay_t<F>>>>
+    MoveOnlyFunctionImpl(F&& f) {
+        using Fn = std::decay_t<F>;
+        if (is_null(f)) return;
+        construct<Fn>(storage, std::forward<F>(f));
+        vtable = &vtable_for<Fn>;
+    }
+
+    // 原地构造可调用对象
+    template <typename F, typename... CArgs>
+    explicit MoveOnlyFunctionImpl(std::in_place_type_t<F>, CArgs&&... cargs) {
+        static_assert(callable<F>);
+        construct<F>(storage, std::forward<CArgs>(cargs)...);
+        vtable = &vtable_for<F>;
+    }
+
+    // 移动构造和赋值，不可拷贝
+    MoveOnlyFunctionImpl(MoveOnlyFunctionImpl&& other) noexcept {
+        move_from(other);
+    }
+    MoveOnlyFunctionImpl& operator=(MoveOnlyFunctionImpl&& other) noexcept {
+        if (this != &other) {
+            reset();
+            move_from(other);
+        }
+        return *this;
+    }
+    MoveOnlyFunctionImpl(const MoveOnlyFunctionImpl&) = delete;
+    MoveOnlyFunctionImpl& operator=(const MoveOnlyFunctionImpl&) = delete;
+
+    ~MoveOnlyFunctionImpl() {
+        reset();
+    }
+
+    R operator()(Args... args) noexcept(Noexcept) requires(!Const) {
+        return call(std::forward<Args>(args)...);
+    }
+    R operator()(Args... args) const noexcept(Noexcept) requires(Const) {
+        return call(std::forward<Args>(args)...);
     }
 
-    explicit operator bool() const {
-        return static_cast<bool>(callable);
+    explicit operator bool() const noexcept {
+        return vtable != nullptr;
     }
-};
\ No newline at end of file
+
+    void swap(MoveOnlyFunctionImpl& other) noexcept {
+        MoveOnlyFunctionImpl tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+};
+
+} // namespace function_detail
+
+// 只能移动的函数包装，可以保存 std::packaged_task、捕获 unique_ptr 的 lambda 等不可拷贝的对象。
+// 支持 R(Args...)、R(Args...) const、R(Args...) noexcept、R(Args...) const noexcept 四种签名
+template <typename>
+class MoveOnlyFunction;
+
+template <typename R, typename... Args>
+class MoveOnlyFunction<R(Args...)> : public function_detail::MoveOnlyFunctionImpl<R, false, false, Args...> {
+    using function_detail::MoveOnlyFunctionImpl<R, false, false, Args...>::MoveOnlyFunctionImpl;
+};
+
+template <typename R, typename... Args>
+class MoveOnlyFunction<R(Args...) const> : public function_detail::MoveOnlyFunctionImpl<R, true, false, Args...> {
+    using function_detail::MoveOnlyFunctionImpl<R, true, false, Args...>::MoveOnlyFunctionImpl;
+};
+
+template <typename R, typename... Args>
+class MoveOnlyFunction<R(Args...) noexcept> : public function_detail::MoveOnlyFunctionImpl<R, false, true, Args...> {
+    using function_detail::MoveOnlyFunctionImpl<R, false, true, Args...>::MoveOnlyFunctionImpl;
+};
+
+template <typename R, typename... Args>
+class MoveOnlyFunction<R(Args...) const noexcept> : public function_detail::MoveOnlyFunctionImpl<R, true, true, Args...> {
+    using function_detail::MoveOnlyFunctionImpl<R, true, true, Args...>::MoveOnlyFunctionImpl;
+};
@@ -0,0 +1,69 @@
+#pragma once
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+template <typename>
+class FunctionRef;
+
+// 不拥有可调用对象的函数引用：只保存对象地址和一个调用函数指针，共两个指针大小，
+// 可平凡复制，从不分配内存。被引用的可调用对象必须比 FunctionRef 活得久，
+// 适合作为只在一次调用期间使用的回调参数（遍历、比较器等），不要保存下来。
+template <typename R, typename... Args>
+class FunctionRef<R(Args...)> {
+    // 普通可调用对象保存地址；函数指针直接保存指针值，避免引用临时的指针变量
+    union Object {
+        void* ptr;
+        void (*fn)();
+    };
+
+    Object object;
+    R (*callback)(Object, Args&&...);
+
+    template <typename F>
+    static R invoke_object(Object object, Args&&... args) {
+        auto* f = static_cast<std::add_pointer_t<std::remove_reference_t<F>>>(object.ptr);
+        if constexpr (std::is_void_v<R>) {
+            std::invoke(*f, std::forward<Args>(args)...);
+        } else {
+            return std::invoke(*f, std::forward<Args>(args)...);
+        }
+    }
+
+    template <typename Fn>
+    static R invoke_function(Object object, Args&&... args) {
+        auto f = reinterpret_cast<Fn>(object.fn);
+        if constexpr (std::is_void_v<R>) {
+            f(std::forward<Args>(args)...);
+        } else {
+            return f(std::forward<Args>(args)...);
+        }
+    }
+
+public:
+    // 构造函数，绑定任意可以用 Args... 调用、结果可以转换为 R 的对象（包括 Function）
+    template <typename F, typename = std::enable_if_t<!std::is_same_v<std::remove_cvref_t<F>, FunctionRef> &&
+                                                      std::is_invocable_r_v<R, F&, Args...>>>
+    FunctionRef(F&& f) noexcept {
+        using Fn = std::decay_t<F>;
+        if constexpr (std::is_function_v<std::remove_pointer_t<Fn>> && std::is_pointer_v<Fn>) {
+            object.fn = reinterpret_cast<void (*)()>(static_cast<Fn>(f));
+            callback = &invoke_function<Fn>;
+        } else {
+            object.ptr = const_cast<void*>(static_cast<const void*>(std::addressof(f)));
+            callback = &invoke_object<F>;
+        }
+    }
+
+    // 拷贝构造和赋值：只复制两个指针
+    FunctionRef(const FunctionRef&) noexcept = default;
+    FunctionRef& operator=(const FunctionRef&) noexcept = default;
+
+    R operator()(Args... args) const {
+        return callback(object, std::forward<Args>(args)...);
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<FunctionRef<void()>>);
+static_assert(sizeof(FunctionRef<void()>) == 2 * sizeof(void*));
@@ -0,0 +1,349 @@
+#pragma once
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <source_location>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+// lock_guard/unique_lock 的锁竞争统计。定义 MYSTL_LOCK_PROFILE 后，守卫的构造函数多一个
+// 默认为调用处的 std::source_location 参数，按加锁位置累计：加锁次数、发生竞争的次数
+// （try_lock 失败后才阻塞）、等待时间和持有时间的总和与 log2 直方图。
+// 计数保存在每个线程自己的表里，记录时没有任何跨线程同步；导出时汇总所有线程，
+// 已退出线程的数据在退出时并入全局表。
+// 未定义时守卫与原来完全相同，本文件中的代码不会被调用
+namespace lock_profile {
+
+#ifdef MYSTL_LOCK_PROFILE
+inline constexpr bool enabled = true;
+#else
+inline constexpr bool enabled = false;
+#endif
+
+// 直方图第 i 个桶统计 [2^(i-1), 2^i) 纳秒，第 0 个桶为 0 纳秒，最后一个桶收纳更长的时间
+constexpr size_t histogram_buckets = 40;
+
+inline size_t bucket_of(uint64_t ns) noexcept {
+    size_t bucket = std::bit_width(ns);
+    return bucket < histogram_buckets ? bucket : histogram_buckets - 1;
+}
+
+inline uint64_t now_ns() noexcept {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// 导出用的汇总结果
+struct SiteReport {
+    std::string file;
+    std::string function;
+    uint32_t line = 0;
+    uint64_t acquisitions = 0;
+    uint64_t contended = 0;
+    uint64_t wait_ns = 0;
+    uint64_t hold_ns = 0;
+    uint64_t wait_histogram[histogram_buckets] = {};
+    uint64_t hold_histogram[histogram_buckets] = {};
+};
+
+// 一个线程在一个加锁位置上的计数。只有所属线程写入（relaxed 读后写，不是 RMW），
+// 导出线程可以同时 relaxed 读取
+struct SiteStats {
+    std::source_location location;
+    std::atomic<uint64_t> acquisitions{0};
+    std::atomic<uint64_t> contended{0};
+    std::atomic<uint64_t> wait_ns{0};
+    std::atomic<uint64_t> hold_ns{0};
+    std::atomic<uint64_t> wait_histogram[histogram_buckets] = {};
+    std::atomic<uint64_t> hold_histogram[histogram_buckets] = {};
+
+    explicit SiteStats(const std::source_location& loc) noexcept : location(loc) {}
+
+    static void bump(std::atomic<uint64_t>& counter, uint64_t n) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+    void record_acquire(bool was_contended, uint64_t waited) noexcept {
+        bump(acquisitions, 1);
+        if (was_contended) bump(contended, 1);
+        bump(wait_ns, waited);
+        bump(wait_histogram[bucket_of(waited)], 1);
+    }
+    void record_release(uint64_t held) noexcept {
+        bump(hold_ns, held);
+        bump(hold_histogram[bucket_of(held)], 1);
+    }
+    void add_to(SiteReport& report) const {
+        report.acquisitions += acquisitions.load(std::memory_order_relaxed);
+        report.contended += contended.load(std::memory_order_relaxed);
+        report.wait_ns += wait_ns.load(std::memory_order_relaxed);
+        report.hold_ns += hold_ns.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < histogram_buckets; ++i) {
+            report.wait_histogram[i] += wait_histogram[i].load(std::memory_order_relaxed);
+            report.hold_histogram[i] += hold_histogram[i].load(std::memory_order_relaxed);
+        }
+    }
+    void clear() noexcept {
+        acquisitions.store(0, std::memory_order_relaxed);
+        contended.store(0, std::memory_order_relaxed);
+        wait_ns.store(0, std::memory_order_relaxed);
+        hold_ns.store(0, std::memory_order_relaxed);
+        for (size_t i = 0; i < histogram_buckets; ++i) {
+            wait_histogram[i].store(0, std::memory_order_relaxed);
+            hold_histogram[i].store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+// 汇总时按 (文件, 行, 函数) 合并不同线程的同一位置
+using SiteKey = std::tuple<std::string, uint32_t, std::string>;
+
+inline SiteKey key_of(const std::source_location& loc) {
+    return {loc.file_name(), loc.line(), loc.function_name()};
+}
+
+inline void merge(SiteReport& into, const SiteReport& from) {
+    into.acquisitions += from.acquisitions;
+    into.contended += from.contended;
+    into.wait_ns += from.wait_ns;
+    into.hold_ns += from.hold_ns;
+    for (size_t i = 0; i < histogram_buckets; ++i) {
+        into.wait_histogram[i] += from.wait_histogram[i];
+        into.hold_histogram[i] += from.hold_histogram[i];
+    }
+}
+
+class ThreadTable;
+
+// 所有线程表的登记处，只在线程首次加锁、线程退出和导出时加锁
+struct Registry {
+    std::mutex mutex;
+    std::vector<ThreadTable*> live;
+    std::map<SiteKey, SiteReport> retired;
+};
+
+inline Registry& registry() {
+    // 有意泄漏：线程可能在静态对象析构之后才退出
+    static Registry* instance = new Registry;
+    return *instance;
+}
+
+// 一个线程的所有加锁位置。查找按 source_location 中的文件名指针和行列号进行，不比较字符串
+class ThreadTable {
+    struct LocationHash {
+        size_t operator()(const std::tuple<const char*, uint32_t, uint32_t>& k) const noexcept {
+            return std::hash<const void*>()(std::get<0>(k)) ^ (size_t(std::get<1>(k)) << 16) ^ std::get<2>(k);
+        }
+    };
+
+    // 插入新位置时与导出线程互斥；所属线程的查找不加锁
+    std::mutex mutex;
+    std::unordered_map<std::tuple<const char*, uint32_t, uint32_t>, std::unique_ptr<SiteStats>, LocationHash> sites;
+    SiteStats* last = nullptr;  // 同一位置反复加锁时省去哈希查找
+
+public:
+    ThreadTable() {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.live.push_back(this);
+    }
+    ~ThreadTable() {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        collect(r.retired);
+        for (size_t i = 0; i < r.live.size(); ++i) {
+            if (r.live[i] == this) {
+                r.live[i] = r.live.back();
+                r.live.pop_back();
+                break;
+            }
+        }
+    }
+
+    SiteStats* site(const std::source_location& loc) {
+        if (last && last->location.file_name() == loc.file_name() && last->location.line() == loc.line() &&
+            last->location.column() == loc.column()) {
+            return last;
+        }
+        auto key = std::make_tuple(loc.file_name(), loc.line(), loc.column());
+        auto it = sites.find(key);
+        if (it == sites.end()) {
+            std::lock_guard<std::mutex> lock(mutex);
+            it = sites.emplace(key, std::make_unique<SiteStats>(loc)).first;
+        }
+        last = it->second.get();
+        return last;
+    }
+
+    // 以下由导出线程在持有 registry 锁时调用
+    void collect(std::map<SiteKey, SiteReport>& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto& [key, stats] : sites) {
+            SiteReport& report = out[key_of(stats->location)];
+            stats->add_to(report);
+        }
+    }
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto& [key, stats] : sites) {
+            stats->clear();
+        }
+    }
+};
+
+inline ThreadTable& thread_table() {
+    thread_local ThreadTable table;
+    return table;
+}
+
+// 守卫内嵌的探针：记录一次加锁的等待时间和是否竞争，释放时记录持有时间。
+// 只保存加锁位置，每次记录时才在当前线程的表中查找：守卫可能被移动到别的线程再解锁，
+// 计数必须写入执行操作的线程自己的表（构造守卫的线程可能已经退出）
+class Probe {
+    std::source_location location;
+    uint64_t acquired_at = 0;
+
+    SiteStats& stats() {
+        return *thread_table().site(location);
+    }
+
+public:
+    Probe() noexcept = default;
+    explicit Probe(const std::source_location& loc) noexcept : location(loc) {}
+
+    template <typename M>
+    void lock(M& m) {
+        if constexpr (requires { { m.try_lock() } -> std::convertible_to<bool>; }) {
+            if (m.try_lock()) {
+                acquired_at = now_ns();
+                stats().record_acquire(false, 0);
+                return;
+            }
+            uint64_t start = now_ns();
+            m.lock();
+            acquired_at = now_ns();
+            stats().record_acquire(true, acquired_at - start);
+        } else {
+            // 无法区分是否竞争，只统计等待时间
+            uint64_t start = now_ns();
+            m.lock();
+            acquired_at = now_ns();
+            stats().record_acquire(false, acquired_at - start);
+        }
+    }
+
+    template <typename M>
+    bool try_lock(M& m) {
+        if (!m.try_lock()) return false;
+        acquired_at = now_ns();
+        stats().record_acquire(false, 0);
+        return true;
+    }
+
+    // 在真正解锁之前调用。会在析构函数中调用，当前线程第一次见到这个位置而分配失败时放弃这次记录
+    void release() noexcept {
+        uint64_t held = now_ns() - acquired_at;
+        try {
+            stats().record_release(held);
+        } catch (...) {
+        }
+    }
+};
+
+// 汇总所有线程（包括已退出线程）的统计，按位置排序
+inline std::vector<SiteReport> snapshot() {
+    std::map<SiteKey, SiteReport> merged;
+    Registry& r = registry();
+    {
+        std::lock_guard<std::mutex> lock(r.mutex);
+        for (ThreadTable* table : r.live) {
+            table->collect(merged);
+        }
+        for (const auto& [key, report] : r.retired) {
+            merge(merged[key], report);
+        }
+    }
+    std::vector<SiteReport> result;
+    result.reserve(merged.size());
+    for (auto& [key, report] : merged) {
+        report.file = std::get<0>(key);
+        report.line = std::get<1>(key);
+        report.function = std::get<2>(key);
+        result.push_back(std::move(report));
+    }
+    return result;
+}
+
+// 遍历汇总后的每个加锁位置
+template <typename F>
+void for_each(F&& f) {
+    for (const SiteReport& report : snapshot()) {
+        f(report);
+    }
+}
+
+// 清零所有计数，用于周期性导出后开始新的统计区间。
+// 与正在进行的记录并发时，个别增量可能在清零前后丢失
+inline void reset() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (ThreadTable* table : r.live) {
+        table->clear();
+    }
+    r.retired.clear();
+}
+
+inline void write_json_string(std::ostream& os, const std::string& s) {
+    os << '"';
+    for (char ch : s) {
+        if (ch == '"' || ch == '\\') os << '\\';
+        os << ch;
+    }
+    os << '"';
+}
+
+inline void write_histogram(std::ostream& os, const uint64_t (&histogram)[histogram_buckets]) {
+    // 省略末尾的空桶
+    size_t used = histogram_buckets;
+    while (used > 0 && histogram[used - 1] == 0) --used;
+    os << '[';
+    for (size_t i = 0; i < used; ++i) {
+        if (i) os << ',';
+        os << histogram[i];
+    }
+    os << ']';
+}
+
+// 以 JSON 数组导出，每个加锁位置一个对象；未开启统计时输出 []
+inline void dump_json(std::ostream& os) {
+    os << '[';
+    bool first = true;
+    for_each([&](const SiteReport& s) {
+        if (!first) os << ',';
+        first = false;
+        os << "{\"file\":";
+        write_json_string(os, s.file);
+        os << ",\"line\":" << s.line << ",\"function\":";
+        write_json_string(os, s.function);
+        os << ",\"acquisitions\":" << s.acquisitions
+           << ",\"contended\":" << s.contended
+           << ",\"wait_ns\":" << s.wait_ns
+           << ",\"hold_ns\":" << s.hold_ns
+           << ",\"wait_histogram\":";
+        write_histogram(os, s.wait_histogram);
+        os << ",\"hold_histogram\":";
+        write_histogram(os, s.hold_histogram);
+        os << '}';
+    });
+    os << ']';
+}
+
+} // namespace lock_profile
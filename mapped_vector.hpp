@@ -0,0 +1,393 @@
+#ifndef MAPPED_VECTOR_H
+#define MAPPED_VECTOR_H
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "vector.hpp"
+
+// 文件映射的只读/写时复制向量：文件由一个带版本的定长头部和紧随其后的元素数组组成，
+// 加载只是一次 mmap，不解析也不复制。只支持可平凡复制的元素类型
+namespace mapped_detail {
+
+inline constexpr char magic[8] = {'M', 'Y', 'S', 'T', 'L', 'V', 'E', 'C'};
+inline constexpr uint32_t format_version = 1;
+
+// 文件头部，所有字段按本机字节序存储
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;   // 元素数组相对文件开头的偏移
+    uint64_t element_size;
+    uint64_t element_align;
+    uint64_t count;
+    uint64_t checksum;      // 元素数组的校验和
+    uint64_t reserved[2];
+};
+static_assert(sizeof(Header) == 64);
+
+// 元素数组的偏移：至少 64 字节，且满足元素的对齐要求（映射起始地址按页对齐）
+template <typename T>
+constexpr uint32_t data_offset() noexcept {
+    return alignof(T) > sizeof(Header) ? alignof(T) : sizeof(Header);
+}
+
+// 按 8 字节一组处理的 64 位校验和，用于发现截断和损坏的文件，不用于防篡改
+inline uint64_t checksum(const void* data, size_t bytes) noexcept {
+    constexpr uint64_t p1 = 0x9E3779B185EBCA87ull;
+    constexpr uint64_t p2 = 0xC2B2AE3D27D4EB4Full;
+    auto* p = static_cast<const unsigned char*>(data);
+    uint64_t h = p2 ^ (bytes * p1);
+    size_t i = 0;
+    for (; i + 8 <= bytes; i += 8) {
+        uint64_t w;
+        std::memcpy(&w, p + i, 8);
+        h ^= w * p1;
+        h = ((h << 31) | (h >> 33)) * p2;
+    }
+    if (i < bytes) {
+        uint64_t w = 0;
+        std::memcpy(&w, p + i, bytes - i);
+        h ^= w * p1;
+        h = ((h << 31) | (h >> 33)) * p2;
+    }
+    h ^= h >> 33;
+    h *= p1;
+    h ^= h >> 29;
+    return h;
+}
+
+[[noreturn]] inline void throw_errno(const std::string& what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+// 关闭文件描述符的 RAII 包装
+struct FileHandle {
+    int fd;
+    explicit FileHandle(int fd) noexcept : fd(fd) {}
+    ~FileHandle() {
+        if (fd >= 0) ::close(fd);
+    }
+    FileHandle(const FileHandle&) = delete;
+    FileHandle& operator=(const FileHandle&) = delete;
+};
+
+inline void write_all(int fd, const void* data, size_t bytes, const std::string& path) {
+    auto* p = static_cast<const char*>(data);
+    while (bytes > 0) {
+        ssize_t n = ::write(fd, p, bytes);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            throw_errno("MappedVector: write " + path);
+        }
+        p += n;
+        bytes -= static_cast<size_t>(n);
+    }
+}
+
+// 先写临时文件并 fsync，再 rename 覆盖目标，最后 fsync 所在目录：
+// 读者要么看到旧文件，要么看到完整的新文件。
+// 临时文件名由进程号和进程内递增的序号组成，并以 O_EXCL 创建：
+// 同一进程内并发保存同一路径时各自写自己的临时文件，最后一次 rename 生效
+inline void write_file_atomically(const std::string& path, const Header& header, uint32_t offset,
+                                  const void* data, size_t bytes) {
+    static std::atomic<uint64_t> save_counter{0};
+    std::string tmp_path = path + ".tmp." + std::to_string(::getpid()) + "." +
+                           std::to_string(save_counter.fetch_add(1, std::memory_order_relaxed));
+    {
+        FileHandle file(::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644));
+        if (file.fd < 0) {
+            throw_errno("MappedVector: open " + tmp_path);
+        }
+        try {
+            char head[256] = {};
+            std::memcpy(head, &header, sizeof(Header));
+            write_all(file.fd, head, offset, tmp_path);
+            write_all(file.fd, data, bytes, tmp_path);
+            if (::fsync(file.fd) != 0) {
+                throw_errno("MappedVector: fsync " + tmp_path);
+            }
+        } catch (...) {
+            ::unlink(tmp_path.c_str());
+            throw;
+        }
+    }
+    if (::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        int saved = errno;
+        ::unlink(tmp_path.c_str());
+        errno = saved;
+        throw_errno("MappedVector: rename " + path);
+    }
+    size_t slash = path.find_last_of('/');
+    std::string dir = slash == std::string::npos ? "." : (slash == 0 ? "/" : path.substr(0, slash));
+    FileHandle dir_file(::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+    if (dir_file.fd >= 0) {
+        ::fsync(dir_file.fd);  // 目录项落盘失败不影响文件内容本身
+    }
+}
+
+} // namespace mapped_detail
+
+template <typename T>
+class MappedVector {
+    static_assert(std::is_trivially_copyable_v<T>, "MappedVector<T> 要求 T 可平凡复制");
+    static_assert(alignof(T) <= 256, "MappedVector<T> 不支持超过 256 字节的对齐");
+
+public:
+    enum class Mode {
+        read_only,      // PROT_READ + MAP_SHARED，多个进程共享同一份物理页
+        copy_on_write,  // MAP_PRIVATE，可以修改元素，修改只在本进程可见，不写回文件
+    };
+
+    using value_type = T;
+    using const_iterator = const T*;
+
+private:
+    void* base;
+    size_t mapped_bytes;
+    T* elements;
+    size_t element_count;
+    uint64_t stored_checksum;
+    Mode mode;
+
+    void unmap() noexcept;
+
+public:
+    // 构造函数声明
+    MappedVector() noexcept;
+    // 映射 path；verify 为 true 时额外校验整个元素数组（会读取全部页）
+    explicit MappedVector(const std::string& path, Mode mode = Mode::read_only, bool verify = false);
+    MappedVector(const MappedVector&) = delete;
+    MappedVector(MappedVector&& other) noexcept;
+    // 赋值运算符声明
+    MappedVector& operator=(const MappedVector&) = delete;
+    MappedVector& operator=(MappedVector&& other) noexcept;
+    // 析构函数声明
+    ~MappedVector();
+    // 访问元素函数声明
+    const T& operator[](size_t index) const;
+    const T& at(size_t index) const;
+    const T* data() const noexcept;
+    // 可写指针，只在 copy_on_write 模式下可用
+    T* mutable_data();
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    // 容量和大小函数声明
+    [[nodiscard]] size_t size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] bool is_open() const noexcept;
+    // 重新计算校验和并与头部比较
+    [[nodiscard]] bool verify_checksum() const noexcept;
+    // 复制成一个普通的 Vector
+    template <typename Alloc = std::allocator<T>>
+    Vector<T, Alloc> to_vector(const Alloc& alloc = Alloc()) const;
+    // 把连续的元素原子地写成快照文件
+    static void write(const std::string& path, const T* first, size_t count);
+    template <typename Alloc>
+    static void write(const std::string& path, const Vector<T, Alloc>& vec);
+};
+
+// 构造函数实现
+template <typename T>
+MappedVector<T>::MappedVector() noexcept
+    : base(nullptr), mapped_bytes(0), elements(nullptr), element_count(0), stored_checksum(0), mode(Mode::read_only) {}
+
+template <typename T>
+MappedVector<T>::MappedVector(const std::string& path, Mode mode, bool verify) : MappedVector() {
+    this->mode = mode;
+    mapped_detail::FileHandle file(::open(path.c_str(), O_RDONLY | O_CLOEXEC));
+    if (file.fd < 0) {
+        mapped_detail::throw_errno("MappedVector: open " + path);
+    }
+    struct stat st;
+    if (::fstat(file.fd, &st) != 0) {
+        mapped_detail::throw_errno("MappedVector: stat " + path);
+    }
+    size_t file_size = static_cast<size_t>(st.st_size);
+    if (file_size < sizeof(mapped_detail::Header)) {
+        throw std::runtime_error("MappedVector: file too small: " + path);
+    }
+    int prot = mode == Mode::read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+    int flags = mode == Mode::read_only ? MAP_SHARED : MAP_PRIVATE;
+    void* p = ::mmap(nullptr, file_size, prot, flags, file.fd, 0);
+    if (p == MAP_FAILED) {
+        mapped_detail::throw_errno("MappedVector: mmap " + path);
+    }
+    base = p;
+    mapped_bytes = file_size;
+
+    mapped_detail::Header header;
+    std::memcpy(&header, base, sizeof(header));
+    auto fail = [&](const char* reason) {
+        unmap();
+        throw std::runtime_error(std::string("MappedVector: ") + reason + ": " + path);
+    };
+    if (std::memcmp(header.magic, mapped_detail::magic, sizeof(header.magic)) != 0) {
+        fail("bad magic");
+    }
+    if (header.version != mapped_detail::format_version) {
+        fail("unsupported version");
+    }
+    if (header.element_size != sizeof(T) || header.element_align != alignof(T)) {
+        fail("element type mismatch");
+    }
+    if (header.header_size != mapped_detail::data_offset<T>() ||
+        header.count > (file_size - header.header_size) / sizeof(T)) {
+        fail("truncated file");
+    }
+    elements = reinterpret_cast<T*>(static_cast<char*>(base) + header.header_size);
+    element_count = static_cast<size_t>(header.count);
+    stored_checksum = header.checksum;
+    if (verify && !verify_checksum()) {
+        fail("checksum mismatch");
+    }
+}
+
+template <typename T>
+MappedVector<T>::MappedVector(MappedVector&& other) noexcept
+    : base(other.base), mapped_bytes(other.mapped_bytes), elements(other.elements),
+      element_count(other.element_count), stored_checksum(other.stored_checksum), mode(other.mode) {
+    other.base = nullptr;
+    other.mapped_bytes = 0;
+    other.elements = nullptr;
+    other.element_count = 0;
+}
+
+// 赋值运算符实现
+template <typename T>
+MappedVector<T>& MappedVector<T>::operator=(MappedVector&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        base = other.base;
+        mapped_bytes = other.mapped_bytes;
+        elements = other.elements;
+        element_count = other.element_count;
+        stored_checksum = other.stored_checksum;
+        mode = other.mode;
+        other.base = nullptr;
+        other.mapped_bytes = 0;
+        other.elements = nullptr;
+        other.element_count = 0;
+    }
+    return *this;
+}
+
+// 析构函数实现
+template <typename T>
+MappedVector<T>::~MappedVector() {
+    unmap();
+}
+
+template <typename T>
+void MappedVector<T>::unmap() noexcept {
+    if (base) {
+        ::munmap(base, mapped_bytes);
+    }
+    base = nullptr;
+    mapped_bytes = 0;
+    elements = nullptr;
+    element_count = 0;
+}
+
+// 访问元素函数实现
+template <typename T>
+const T& MappedVector<T>::operator[](size_t index) const {
+#ifndef MYSTL_VECTOR_UNCHECKED
+    if (index >= element_count) {
+        throw std::out_of_range("MappedVector::operator[]");
+    }
+#endif
+    return elements[index];
+}
+
+template <typename T>
+const T& MappedVector<T>::at(size_t index) const {
+    if (index >= element_count) {
+        throw std::out_of_range("MappedVector::at");
+    }
+    return elements[index];
+}
+
+template <typename T>
+const T* MappedVector<T>::data() const noexcept {
+    return elements;
+}
+
+template <typename T>
+T* MappedVector<T>::mutable_data() {
+    if (mode != Mode::copy_on_write) {
+        throw std::logic_error("MappedVector::mutable_data requires copy_on_write mode");
+    }
+    return elements;
+}
+
+template <typename T>
+typename MappedVector<T>::const_iterator MappedVector<T>::begin() const noexcept {
+    return elements;
+}
+
+template <typename T>
+typename MappedVector<T>::const_iterator MappedVector<T>::end() const noexcept {
+    return elements + element_count;
+}
+
+// 容量和大小函数实现
+template <typename T>
+size_t MappedVector<T>::size() const noexcept {
+    return element_count;
+}
+
+template <typename T>
+bool MappedVector<T>::empty() const noexcept {
+    return element_count == 0;
+}
+
+template <typename T>
+bool MappedVector<T>::is_open() const noexcept {
+    return base != nullptr;
+}
+
+template <typename T>
+bool MappedVector<T>::verify_checksum() const noexcept {
+    return mapped_detail::checksum(elements, element_count * sizeof(T)) == stored_checksum;
+}
+
+template <typename T>
+template <typename Alloc>
+Vector<T, Alloc> MappedVector<T>::to_vector(const Alloc& alloc) const {
+    Vector<T, Alloc> vec(alloc);
+    vec.assign(elements, elements + element_count);
+    return vec;
+}
+
+// 快照写入函数实现
+template <typename T>
+void MappedVector<T>::write(const std::string& path, const T* first, size_t count) {
+    mapped_detail::Header header{};
+    std::memcpy(header.magic, mapped_detail::magic, sizeof(header.magic));
+    header.version = mapped_detail::format_version;
+    header.header_size = mapped_detail::data_offset<T>();
+    header.element_size = sizeof(T);
+    header.element_align = alignof(T);
+    header.count = count;
+    header.checksum = mapped_detail::checksum(first, count * sizeof(T));
+    mapped_detail::write_file_atomically(path, header, header.header_size, first, count * sizeof(T));
+}
+
+template <typename T>
+template <typename Alloc>
+void MappedVector<T>::write(const std::string& path, const Vector<T, Alloc>& vec) {
+    write(path, vec.data(), vec.size());
+}
+
+#endif // MAPPED_VECTOR_H
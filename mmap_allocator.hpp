@@ -0,0 +1,179 @@
+#ifndef MMAP_ALLOCATOR_H
+#define MMAP_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// 大块内存分配器：超过阈值的请求直接用匿名 mmap 映射，扩容时用 mremap 重新映射页表，
+// 可平凡重定位的元素不需要复制，也不需要"新旧两块内存同时存在"的峰值。
+// 小于阈值的请求走 malloc/realloc，避免小容器每次扩容都进入内核。
+// 提供 reallocate(p, old_n, new_n)，Vector 检测到这个成员且元素可按位重定位时改用它扩容
+namespace mmap_detail {
+
+// 与 glibc 默认的 M_MMAP_THRESHOLD 一致
+inline constexpr size_t mmap_threshold = 128 * 1024;
+// 达到这个大小才申请透明大页
+inline constexpr size_t huge_page_size = 2 * 1024 * 1024;
+
+inline size_t page_size() noexcept {
+    static const size_t size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+inline size_t round_to_pages(size_t bytes) noexcept {
+    size_t page = page_size();
+    return (bytes + page - 1) / page * page;
+}
+
+inline void advise_huge_pages(void* p, size_t bytes) noexcept {
+#ifdef MADV_HUGEPAGE
+    if (bytes >= huge_page_size) {
+        ::madvise(p, bytes, MADV_HUGEPAGE);  // 只是建议，失败不影响正确性
+    }
+#else
+    (void)p;
+    (void)bytes;
+#endif
+}
+
+inline void* map(size_t bytes, bool huge_pages) {
+    void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    if (huge_pages) {
+        advise_huge_pages(p, bytes);
+    }
+    return p;
+}
+
+inline void* remap(void* p, size_t old_bytes, size_t new_bytes, bool huge_pages) {
+#ifdef MREMAP_MAYMOVE
+    void* q = ::mremap(p, old_bytes, new_bytes, MREMAP_MAYMOVE);
+    if (q == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    if (huge_pages && new_bytes > old_bytes) {
+        advise_huge_pages(q, new_bytes);
+    }
+    return q;
+#else
+    // 没有 mremap 的平台：映射新区域后复制
+    void* q = map(new_bytes, huge_pages);
+    std::memcpy(q, p, old_bytes < new_bytes ? old_bytes : new_bytes);
+    ::munmap(p, old_bytes);
+    return q;
+#endif
+}
+
+} // namespace mmap_detail
+
+template <typename T>
+class MmapAllocator {
+    template <typename U>
+    friend class MmapAllocator;
+
+    bool huge_pages;
+
+    // 超过阈值或对齐要求超过 malloc 保证的请求使用 mmap（页对齐满足任何常见对齐）
+    static bool use_mmap(size_t bytes) noexcept {
+        return bytes >= mmap_detail::mmap_threshold || alignof(T) > alignof(std::max_align_t);
+    }
+
+    static size_t bytes_for(size_t n) {
+        if (n > static_cast<size_t>(-1) / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        return n * sizeof(T);
+    }
+
+public:
+    using value_type = T;
+    // 任意实例分配的内存都可以由另一实例释放，huge_pages 只影响新映射
+    using is_always_equal = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+
+    explicit MmapAllocator(bool huge_pages = true) noexcept : huge_pages(huge_pages) {}
+
+    template <typename U>
+    MmapAllocator(const MmapAllocator<U>& other) noexcept : huge_pages(other.huge_pages) {}
+
+    T* allocate(size_t n) {
+        size_t bytes = bytes_for(n);
+        if (use_mmap(bytes)) {
+            return static_cast<T*>(mmap_detail::map(mmap_detail::round_to_pages(bytes), huge_pages));
+        }
+        void* p = std::malloc(bytes ? bytes : 1);
+        if (!p) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        if (!p) return;
+        size_t bytes = n * sizeof(T);
+        if (use_mmap(bytes)) {
+            ::munmap(p, mmap_detail::round_to_pages(bytes));
+        } else {
+            std::free(p);
+        }
+    }
+
+    // 把容量为 old_n 的内存调整为 new_n，前 min(old_n, new_n) 个元素按位保留。
+    // 只能用于可平凡重定位的元素；缩小时尾部的页直接归还给内核。
+    // 失败时抛出 std::bad_alloc，原内存保持不变
+    T* reallocate(T* p, size_t old_n, size_t new_n) {
+        size_t old_bytes = old_n * sizeof(T);
+        size_t new_bytes = bytes_for(new_n);
+        bool old_mapped = use_mmap(old_bytes);
+        bool new_mapped = use_mmap(new_bytes);
+        if (old_mapped && new_mapped) {
+            size_t old_pages = mmap_detail::round_to_pages(old_bytes);
+            size_t new_pages = mmap_detail::round_to_pages(new_bytes);
+            if (old_pages == new_pages) return p;
+            return static_cast<T*>(mmap_detail::remap(p, old_pages, new_pages, huge_pages));
+        }
+        if (!old_mapped && !new_mapped) {
+            void* q = std::realloc(p, new_bytes ? new_bytes : 1);
+            if (!q) {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(q);
+        }
+        // 跨越阈值：换一种后端，只在这一次复制
+        T* q = allocate(new_n);
+        std::memcpy(static_cast<void*>(q), static_cast<const void*>(p), old_bytes < new_bytes ? old_bytes : new_bytes);
+        deallocate(p, old_n);
+        return q;
+    }
+
+    // 对已缩小使用量的内存，把 used_n 之后完整的页交还内核，容量不变，再次写入时按需补零页
+    void discard(T* p, size_t capacity_n, size_t used_n) noexcept {
+        size_t bytes = capacity_n * sizeof(T);
+        if (!p || !use_mmap(bytes)) return;
+        size_t keep = mmap_detail::round_to_pages(used_n * sizeof(T));
+        size_t total = mmap_detail::round_to_pages(bytes);
+        // 释放量太小时不值得一次系统调用
+        if (total - keep >= mmap_detail::mmap_threshold) {
+            ::madvise(reinterpret_cast<char*>(p) + keep, total - keep, MADV_DONTNEED);
+        }
+    }
+
+    template <typename U>
+    bool operator==(const MmapAllocator<U>&) const noexcept {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const MmapAllocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+#endif // MMAP_ALLOCATOR_H
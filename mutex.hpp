@@ -1,32 +1,513 @@
 #pragma once
 #include <stdexcept>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include "lock_profile.hpp"
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace mutex_detail {
+
+// 自旋等待时提示 CPU 当前处于忙等，降低功耗并让出超线程的执行资源
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+// 指数退避：每次等待的 pause 次数翻倍，超过上限后改为让出时间片，
+// 避免持有者被抢占时等待者空转整个调度周期
+class Backoff {
+    unsigned max_spins;
+    unsigned spins = 1;
+    public:
+        // 上限越小越早让出时间片，适合等待对象很可能正被抢占的场景
+        explicit Backoff(unsigned max_spins = 1024) noexcept : max_spins(max_spins) {}
+
+        void pause() noexcept {
+            if (spins <= max_spins) {
+                for (unsigned i = 0; i < spins; ++i) {
+                    cpu_relax();
+                }
+                spins <<= 1;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+};
+
+#ifdef __linux__
+static_assert(sizeof(std::atomic<int>) == sizeof(int), "futex 需要 std::atomic<int> 与 int 布局相同");
+
+inline void futex_wait(std::atomic<int>* word, int expected) noexcept {
+    syscall(SYS_futex, reinterpret_cast<int*>(word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+}
+
+inline void futex_wake_one(std::atomic<int>* word) noexcept {
+    syscall(SYS_futex, reinterpret_cast<int*>(word), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+}
+
+inline void futex_wake_all(std::atomic<int>* word) noexcept {
+    syscall(SYS_futex, reinterpret_cast<int*>(word), FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+}
+#else
+inline void futex_wait(std::atomic<int>* word, int expected) noexcept {
+    word->wait(expected, std::memory_order_relaxed);
+}
+
+inline void futex_wake_one(std::atomic<int>* word) noexcept {
+    word->notify_one();
+}
+
+inline void futex_wake_all(std::atomic<int>* word) noexcept {
+    word->notify_all();
+}
+#endif
+
+} // namespace mutex_detail
+
+// TTAS 自旋锁：先只读地观察锁状态，空闲时才尝试 exchange，等待期间不反复抢占缓存行。
+// 适合临界区只有几十纳秒、持有者几乎不会被抢占的场景
+class SpinLock {
+    std::atomic<bool> locked{false};
+    public:
+        SpinLock() noexcept = default;
+        SpinLock(const SpinLock&) = delete;
+        SpinLock& operator=(const SpinLock&) = delete;
+
+        void lock() noexcept {
+            mutex_detail::Backoff backoff;
+            while (locked.exchange(true, std::memory_order_acquire)) {
+                do {
+                    backoff.pause();
+                } while (locked.load(std::memory_order_relaxed));
+            }
+        }
+        bool try_lock() noexcept {
+            return !locked.load(std::memory_order_relaxed) && !locked.exchange(true, std::memory_order_acquire);
+        }
+        void unlock() noexcept {
+            locked.store(false, std::memory_order_release);
+        }
+};
+
+// 基于 futex 的互斥锁，状态 0 空闲、1 已加锁、2 已加锁且可能有线程在内核中等待。
+// 加锁失败时先自旋一段时间，自旋上限根据最近几次自旋成功所需的次数自适应调整；
+// 自旋仍未拿到锁才进入内核睡眠。解锁只有在状态为 2 时才需要系统调用
+class FutexMutex {
+    static constexpr int max_spin = 256;
+
+    std::atomic<int> state{0};
+    std::atomic<int> spin_estimate{16};  // 最近自旋成功所需次数的滑动平均
+
+    void lock_slow() noexcept {
+        int limit = spin_estimate.load(std::memory_order_relaxed) * 2 + 8;
+        if (limit > max_spin) limit = max_spin;
+        int c = 0;
+        for (int i = 0; i < limit; ++i) {
+            mutex_detail::cpu_relax();
+            c = state.load(std::memory_order_relaxed);
+            if (c == 2) break;  // 已经有线程在睡眠，继续自旋意义不大
+            if (c == 0 && state.compare_exchange_weak(c, 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                int estimate = spin_estimate.load(std::memory_order_relaxed);
+                spin_estimate.store(estimate + (i - estimate) / 8, std::memory_order_relaxed);
+                return;
+            }
+        }
+        // 自旋失败：标记有等待者并睡眠，被唤醒后同样以状态 2 重新抢锁
+        c = state.exchange(2, std::memory_order_acquire);
+        while (c != 0) {
+            mutex_detail::futex_wait(&state, 2);
+            c = state.exchange(2, std::memory_order_acquire);
+        }
+    }
+    public:
+        FutexMutex() noexcept = default;
+        FutexMutex(const FutexMutex&) = delete;
+        FutexMutex& operator=(const FutexMutex&) = delete;
+
+        void lock() noexcept {
+            int c = 0;
+            if (!state.compare_exchange_strong(c, 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                lock_slow();
+            }
+        }
+        bool try_lock() noexcept {
+            int c = 0;
+            return state.compare_exchange_strong(c, 1, std::memory_order_acquire, std::memory_order_relaxed);
+        }
+        void unlock() noexcept {
+            if (state.exchange(0, std::memory_order_release) == 2) {
+                mutex_detail::futex_wake_one(&state);
+            }
+        }
+};
+
+// 票据锁：按取号顺序获得锁，严格 FIFO，不会饿死。
+// 只有下一个号的等待者自旋（指数退避，到上限后让出时间片），其余等待者直接让出时间片。
+// 注意：线程数超过核数时公平自旋锁（票据锁、MCS 锁）的吞吐量会崩溃：锁只能交给下一个号，
+// 而这个线程可能正被抢占，其他所有线程都只能等它重新被调度，每次交接至少一次调度切换
+// （单核 8 线程时比 FutexMutex 慢约两个数量级）。线程可能多于核数时请用 FutexMutex
+class TicketLock {
+    std::atomic<uint32_t> next_ticket{0};
+    std::atomic<uint32_t> now_serving{0};
+    public:
+        TicketLock() noexcept = default;
+        TicketLock(const TicketLock&) = delete;
+        TicketLock& operator=(const TicketLock&) = delete;
+
+        void lock() noexcept {
+            uint32_t ticket = next_ticket.fetch_add(1, std::memory_order_relaxed);
+            mutex_detail::Backoff backoff;
+            while (true) {
+                uint32_t serving = now_serving.load(std::memory_order_acquire);
+                if (serving == ticket) return;
+                if (ticket - serving > 1) {
+                    std::this_thread::yield();
+                } else {
+                    backoff.pause();
+                }
+            }
+        }
+        bool try_lock() noexcept {
+            // acquire 与上一个持有者 unlock 中的 release 配对
+            uint32_t serving = now_serving.load(std::memory_order_acquire);
+            uint32_t expected = serving;
+            return next_ticket.compare_exchange_strong(expected, serving + 1, std::memory_order_acquire,
+                                                       std::memory_order_relaxed);
+        }
+        void unlock() noexcept {
+            now_serving.store(now_serving.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+};
+
+namespace mutex_detail {
+
+// MCS 队列节点，每个等待者只在自己的节点上自旋
+struct alignas(64) McsNode {
+    std::atomic<McsNode*> next{nullptr};
+    std::atomic<bool> locked{false};
+    McsNode* pool_next = nullptr;
+};
+
+// 每个线程缓存用过的节点，线程退出时释放。同一线程可以同时持有多把 MCS 锁
+class McsNodeCache {
+    McsNode* head = nullptr;
+    public:
+        ~McsNodeCache() {
+            while (head) {
+                McsNode* next = head->pool_next;
+                delete head;
+                head = next;
+            }
+        }
+        McsNode* acquire() {
+            if (!head) return new McsNode;
+            McsNode* node = head;
+            head = node->pool_next;
+            return node;
+        }
+        void release(McsNode* node) noexcept {
+            node->pool_next = head;
+            head = node;
+        }
+};
+
+constexpr unsigned mcs_max_spins = 8;
+
+inline McsNodeCache& mcs_node_cache() {
+    thread_local McsNodeCache cache;
+    return cache;
+}
+
+} // namespace mutex_detail
+
+// MCS 队列锁：公平的 FIFO 锁，等待者排成链表并在各自的节点上自旋，
+// 释放锁只写后继者的节点，高竞争下没有全局缓存行来回传递。
+// 与票据锁一样，线程数超过核数时锁会交给被抢占的后继者，吞吐量崩溃
+class McsLock {
+    std::atomic<mutex_detail::McsNode*> tail{nullptr};
+    mutex_detail::McsNode* holder = nullptr;  // 只由持有锁的线程读写
+    public:
+        McsLock() noexcept = default;
+        McsLock(const McsLock&) = delete;
+        McsLock& operator=(const McsLock&) = delete;
+
+        void lock() {
+            mutex_detail::McsNode* node = mutex_detail::mcs_node_cache().acquire();
+            node->next.store(nullptr, std::memory_order_relaxed);
+            node->locked.store(true, std::memory_order_relaxed);
+            mutex_detail::McsNode* prev = tail.exchange(node, std::memory_order_acq_rel);
+            if (prev) {
+                prev->next.store(node, std::memory_order_release);
+                // 交接链上任何一个线程被抢占都会挡住后面所有人，短暂自旋后就让出时间片
+                mutex_detail::Backoff backoff(mutex_detail::mcs_max_spins);
+                while (node->locked.load(std::memory_order_acquire)) {
+                    backoff.pause();
+                }
+            }
+            holder = node;
+        }
+        bool try_lock() {
+            mutex_detail::McsNode* node = mutex_detail::mcs_node_cache().acquire();
+            node->next.store(nullptr, std::memory_order_relaxed);
+            mutex_detail::McsNode* expected = nullptr;
+            if (tail.compare_exchange_strong(expected, node, std::memory_order_acquire, std::memory_order_relaxed)) {
+                holder = node;
+                return true;
+            }
+            mutex_detail::mcs_node_cache().release(node);
+            return false;
+        }
+        void unlock() noexcept {
+            mutex_detail::McsNode* node = holder;
+            mutex_detail::McsNode* next = node->next.load(std::memory_order_acquire);
+            if (!next) {
+                mutex_detail::McsNode* expected = node;
+                if (tail.compare_exchange_strong(expected, nullptr, std::memory_order_release,
+                                                 std::memory_order_relaxed)) {
+                    mutex_detail::mcs_node_cache().release(node);
+                    return;
+                }
+                // 有后继者正在入队，等它把自己链到 node 后面；它可能恰好被抢占，退避到上限后让出时间片
+                mutex_detail::Backoff backoff;
+                while (!(next = node->next.load(std::memory_order_acquire))) {
+                    backoff.pause();
+                }
+            }
+            next->locked.store(false, std::memory_order_release);
+            mutex_detail::mcs_node_cache().release(node);
+        }
+};
+
+namespace mutex_detail {
+
+constexpr size_t reader_stripes = 16;
+
+// 读者计数槽，每个槽独占一条缓存行
+struct alignas(64) ReaderStripe {
+    std::atomic<int64_t> count{0};
+};
+
+// 线程首次使用时轮流分配一个槽号，不同线程的读操作尽量落在不同缓存行上
+inline size_t reader_stripe_index() noexcept {
+    static std::atomic<size_t> next{0};
+    thread_local size_t index = next.fetch_add(1, std::memory_order_relaxed) % reader_stripes;
+    return index;
+}
+
+} // namespace mutex_detail
+
+// 读写锁：读者计数分散在多个缓存行上，读加锁只修改本线程对应的槽，读者之间互不争用。
+// 写者优先：写者先声明意图，此后新来的读者退让等待，已经进入的读者全部离开后写者获得锁，
+// 因此持续的读流量不会饿死写者。写者之间由 FutexMutex 串行化。
+// 读锁必须由加锁的线程释放（计数记在该线程的槽上）
+class SharedMutex {
+    mutex_detail::ReaderStripe stripes[mutex_detail::reader_stripes];
+    // 0 无写者；1 有写者持有锁或正在等待读者离开；2 同上且有读者在 futex 上睡眠
+    alignas(64) std::atomic<int> writer{0};
+    FutexMutex writer_mutex;
+
+    bool readers_present() const noexcept {
+        for (const mutex_detail::ReaderStripe& stripe : stripes) {
+            if (stripe.count.load(std::memory_order_seq_cst) != 0) return true;
+        }
+        return false;
+    }
+    void release_writer() noexcept {
+        if (writer.exchange(0, std::memory_order_seq_cst) == 2) {
+            mutex_detail::futex_wake_all(&writer);
+        }
+    }
+    public:
+        SharedMutex() noexcept = default;
+        SharedMutex(const SharedMutex&) = delete;
+        SharedMutex& operator=(const SharedMutex&) = delete;
+
+        // 写锁（独占）
+        void lock() noexcept {
+            writer_mutex.lock();
+            writer.store(1, std::memory_order_seq_cst);
+            mutex_detail::Backoff backoff;
+            while (readers_present()) {
+                backoff.pause();
+            }
+        }
+        bool try_lock() noexcept {
+            if (!writer_mutex.try_lock()) return false;
+            writer.store(1, std::memory_order_seq_cst);
+            if (readers_present()) {
+                release_writer();
+                writer_mutex.unlock();
+                return false;
+            }
+            return true;
+        }
+        void unlock() noexcept {
+            release_writer();
+            writer_mutex.unlock();
+        }
+
+        // 读锁（共享）。计数递增与检查写者标志都是 seq_cst，与写者的"先置标志再检查计数"配对，
+        // 保证双方至少有一方看到对方
+        void lock_shared() noexcept {
+            std::atomic<int64_t>& count = stripes[mutex_detail::reader_stripe_index()].count;
+            while (true) {
+                count.fetch_add(1, std::memory_order_seq_cst);
+                if (writer.load(std::memory_order_seq_cst) == 0) return;
+                count.fetch_sub(1, std::memory_order_release);
+                // 写者优先：等写者释放后再重试
+                for (int i = 0; i < 64 && writer.load(std::memory_order_relaxed) != 0; ++i) {
+                    mutex_detail::cpu_relax();
+                }
+                while (true) {
+                    int w = writer.load(std::memory_order_acquire);
+                    if (w == 0) break;
+                    // 睡眠前把状态改为 2，写者释放时才知道需要唤醒
+                    if (w == 1 && !writer.compare_exchange_weak(w, 2, std::memory_order_relaxed)) continue;
+                    mutex_detail::futex_wait(&writer, 2);
+                }
+            }
+        }
+        bool try_lock_shared() noexcept {
+            std::atomic<int64_t>& count = stripes[mutex_detail::reader_stripe_index()].count;
+            count.fetch_add(1, std::memory_order_seq_cst);
+            if (writer.load(std::memory_order_seq_cst) == 0) return true;
+            count.fetch_sub(1, std::memory_order_release);
+            return false;
+        }
+        void unlock_shared() noexcept {
+            stripes[mutex_detail::reader_stripe_index()].count.fetch_sub(1, std::memory_order_release);
+        }
+};
+
+// 顺序锁，保护可平凡复制的小对象：写者递增序号（奇数表示正在写），读者不加锁地复制数据，
+// 复制前后序号相同且为偶数才算读到一致的快照，否则重试。读者不写任何共享内存。
+// 数据按 8 字节分块保存在原子变量中，读写都是 relaxed 原子操作，与写者并发也不构成数据竞争
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock 只能保护可平凡复制的类型");
+    static constexpr size_t word_count = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    std::atomic<uint32_t> sequence{0};
+    std::atomic<uint64_t> words[word_count];
+
+    void write_words(const T& value) noexcept {
+        uint64_t buffer[word_count] = {};
+        std::memcpy(buffer, &value, sizeof(T));
+        for (size_t i = 0; i < word_count; ++i) {
+            words[i].store(buffer[i], std::memory_order_relaxed);
+        }
+    }
+    public:
+        SeqLock() noexcept : SeqLock(T{}) {}
+        explicit SeqLock(const T& value) noexcept {
+            write_words(value);
+        }
+        SeqLock(const SeqLock&) = delete;
+        SeqLock& operator=(const SeqLock&) = delete;
+
+        T load() const noexcept {
+            uint64_t buffer[word_count];
+            mutex_detail::Backoff backoff;
+            while (true) {
+                uint32_t before = sequence.load(std::memory_order_acquire);
+                if ((before & 1) == 0) {
+                    for (size_t i = 0; i < word_count; ++i) {
+                        buffer[i] = words[i].load(std::memory_order_relaxed);
+                    }
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (sequence.load(std::memory_order_relaxed) == before) break;
+                }
+                backoff.pause();
+            }
+            T value;
+            std::memcpy(&value, buffer, sizeof(T));
+            return value;
+        }
+        // 多个写者通过把序号从偶数 CAS 成奇数互斥。成功的 CAS 用 acquire，与上一个写者
+        // 释放序号的 release 配对，保证两个写者对 words 的写入有先后顺序
+        void store(const T& value) noexcept {
+            uint32_t current = sequence.load(std::memory_order_relaxed);
+            mutex_detail::Backoff backoff;
+            while ((current & 1) != 0 ||
+                   !sequence.compare_exchange_weak(current, current + 1, std::memory_order_acquire,
+                                                   std::memory_order_relaxed)) {
+                backoff.pause();
+                current = sequence.load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_release);
+            write_words(value);
+            sequence.store(current + 2, std::memory_order_release);
+        }
+};
+
 template <typename T>
 class lock_guard {
     T* ptr_;
+#ifdef MYSTL_LOCK_PROFILE
+    lock_profile::Probe probe_;
+#endif
+    void release() {
+#ifdef MYSTL_LOCK_PROFILE
+        probe_.release();
+#endif
+        ptr_->unlock();
+    }
     public:
         lock_guard() = delete;
 
-        template <typename U = T, 
+        template <typename U = T,
                   typename = std::enable_if_t<
-                      std::is_member_function_pointer<decltype(&U::lock)>::value 
+                      std::is_member_function_pointer<decltype(&U::lock)>::value
                       && std::is_member_function_pointer<decltype(&U::unlock)>::value,
                       void
                   >>
+#ifdef MYSTL_LOCK_PROFILE
+        // 统计模式：记录到调用处的加锁位置
+        explicit lock_guard(T* ptr, std::source_location site = std::source_location::current())
+            : ptr_(ptr), probe_(site) {
+            probe_.lock(*ptr_);
+        }
+#else
         explicit lock_guard(T* ptr) : ptr_(ptr) {
             ptr_->lock();
         }
-        
+#endif
+
         ~lock_guard() {
-            ptr_->unlock();    
+            if (ptr_) {
+                release();
+            }
         }
         lock_guard(const lock_guard&) = delete;
         lock_guard& operator=(const lock_guard&) = delete;
         lock_guard(lock_guard&& other) noexcept : ptr_(other.ptr_) {
+#ifdef MYSTL_LOCK_PROFILE
+            probe_ = other.probe_;
+#endif
             other.ptr_ = nullptr;
         }
         lock_guard& operator=(lock_guard&& other) noexcept {
-            ptr_ = other.ptr_;
-            other.ptr_ = nullptr;
+            if (this != &other) {
+                if (ptr_) {
+                    release();
+                }
+                ptr_ = other.ptr_;
+#ifdef MYSTL_LOCK_PROFILE
+                probe_ = other.probe_;
+#endif
+                other.ptr_ = nullptr;
+            }
             return *this;
         }
 };
@@ -34,46 +515,181 @@ class lock_guard {
 template <typename T>
 class unique_lock {
     T* ptr_;
+    bool owns_;
+#ifdef MYSTL_LOCK_PROFILE
+    lock_profile::Probe probe_;
+#endif
+    void release() {
+#ifdef MYSTL_LOCK_PROFILE
+        probe_.release();
+#endif
+        ptr_->unlock();
+    }
     public:
         unique_lock() = delete;
 
-        template <typename  T, 
+        template <typename U = T,
                   typename = std::enable_if_t<
-                      std::is_member_function_pointer<decltype(&T::lock)>::value 
-                      && std::is_member_function_pointer<decltype(&T::unlock)>::value
-                      && std::is_member_function_pointer<decltype(&T::try_lock)>::value,
+                      std::is_member_function_pointer<decltype(&U::lock)>::value
+                      && std::is_member_function_pointer<decltype(&U::unlock)>::value
+                      && std::is_member_function_pointer<decltype(&U::try_lock)>::value,
                       void
                   >>
-        explicit unique_lock(T* ptr) : ptr_(ptr) {
-            ptr_->lock();
+#ifdef MYSTL_LOCK_PROFILE
+        // 统计模式：之后的 lock/try_lock 都记录到构造处的加锁位置
+        explicit unique_lock(T* ptr, std::source_location site = std::source_location::current())
+            : ptr_(ptr), owns_(false), probe_(site) {
+            lock();
+        }
+#else
+        explicit unique_lock(T* ptr) : ptr_(ptr), owns_(false) {
+            lock();
         }
+#endif
         ~unique_lock() {
-            ptr_->unlock();
+            if (owns_) {
+                release();
+            }
         }
         void lock() {
             if (!ptr_) {
                 throw std::runtime_error("尝试对空互斥锁进行加锁操作");
             }
-            // 尝试加锁，如果已经被锁定则抛出异常
-            if (!ptr_->try_lock()) {
+            // 已经持有锁时再次加锁会死锁，直接抛出异常
+            if (owns_) {
                 throw std::runtime_error("互斥锁已被锁定，无法再次加锁");
             }
+#ifdef MYSTL_LOCK_PROFILE
+            probe_.lock(*ptr_);
+#else
             ptr_->lock();
+#endif
+            owns_ = true;
+        }
+        bool try_lock() {
+            if (!ptr_) {
+                throw std::runtime_error("尝试对空互斥锁进行加锁操作");
+            }
+            if (owns_) {
+                throw std::runtime_error("互斥锁已被锁定，无法再次加锁");
+            }
+#ifdef MYSTL_LOCK_PROFILE
+            owns_ = probe_.try_lock(*ptr_);
+#else
+            owns_ = ptr_->try_lock();
+#endif
+            return owns_;
         }
         void unlock() {
             if (!ptr_) {
                 throw std::runtime_error("尝试对空互斥锁进行解锁操作");
             }
-            ptr_->unlock();
+            if (!owns_) {
+                throw std::runtime_error("互斥锁未被当前对象锁定，无法解锁");
+            }
+            release();
+            owns_ = false;
+        }
+        [[nodiscard]] bool owns_lock() const noexcept {
+            return owns_;
         }
         unique_lock(const unique_lock&) = delete;
         unique_lock& operator=(const unique_lock&) = delete;
-        unique_lock(unique_lock&& other) noexcept : ptr_(other.ptr_) {
+        unique_lock(unique_lock&& other) noexcept : ptr_(other.ptr_), owns_(other.owns_) {
+#ifdef MYSTL_LOCK_PROFILE
+            probe_ = other.probe_;
+#endif
             other.ptr_ = nullptr;
+            other.owns_ = false;
         }
         unique_lock& operator=(unique_lock&& other) noexcept {
-            ptr_ = other.ptr_;
+            if (this != &other) {
+                if (owns_) {
+                    release();
+                }
+                ptr_ = other.ptr_;
+                owns_ = other.owns_;
+#ifdef MYSTL_LOCK_PROFILE
+                probe_ = other.probe_;
+#endif
+                other.ptr_ = nullptr;
+                other.owns_ = false;
+            }
+            return *this;
+        }
+};
+
+template <typename T>
+class shared_lock {
+    T* ptr_;
+    bool owns_;
+    public:
+        shared_lock() = delete;
+
+        template <typename U = T,
+                  typename = std::enable_if_t<
+                      std::is_member_function_pointer<decltype(&U::lock_shared)>::value
+                      && std::is_member_function_pointer<decltype(&U::unlock_shared)>::value
+                      && std::is_member_function_pointer<decltype(&U::try_lock_shared)>::value,
+                      void
+                  >>
+        explicit shared_lock(T* ptr) : ptr_(ptr), owns_(false) {
+            lock();
+        }
+        ~shared_lock() {
+            if (owns_) {
+                ptr_->unlock_shared();
+            }
+        }
+        void lock() {
+            if (!ptr_) {
+                throw std::runtime_error("尝试对空互斥锁进行加锁操作");
+            }
+            if (owns_) {
+                throw std::runtime_error("互斥锁已被锁定，无法再次加锁");
+            }
+            ptr_->lock_shared();
+            owns_ = true;
+        }
+        bool try_lock() {
+            if (!ptr_) {
+                throw std::runtime_error("尝试对空互斥锁进行加锁操作");
+            }
+            if (owns_) {
+                throw std::runtime_error("互斥锁已被锁定，无法再次加锁");
+            }
+            owns_ = ptr_->try_lock_shared();
+            return owns_;
+        }
+        void unlock() {
+            if (!ptr_) {
+                throw std::runtime_error("尝试对空互斥锁进行解锁操作");
+            }
+            if (!owns_) {
+                throw std::runtime_error("互斥锁未被当前对象锁定，无法解锁");
+            }
+            ptr_->unlock_shared();
+            owns_ = false;
+        }
+        [[nodiscard]] bool owns_lock() const noexcept {
+            return owns_;
+        }
+        shared_lock(const shared_lock&) = delete;
+        shared_lock& operator=(const shared_lock&) = delete;
+        shared_lock(shared_lock&& other) noexcept : ptr_(other.ptr_), owns_(other.owns_) {
             other.ptr_ = nullptr;
+            other.owns_ = false;
+        }
+        shared_lock& operator=(shared_lock&& other) noexcept {
+            if (this != &other) {
+                if (owns_) {
+                    ptr_->unlock_shared();
+                }
+                ptr_ = other.ptr_;
+                owns_ = other.owns_;
+                other.ptr_ = nullptr;
+                other.owns_ = false;
+            }
             return *this;
         }
-};
\ No newline at end of file
+};
@@ -0,0 +1,328 @@
+#ifndef PARALLEL_ALGORITHM_H
+#define PARALLEL_ALGORITHM_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "vector.hpp"
+#include "sort.hpp"
+#include "singleton_thread_pool.hpp"
+
+// Vector 上的并行算法：把区间切成若干连续的块提交到 SingletonThreadPool，
+// 调用线程执行第一块并在等待时帮忙执行队列中的任务（因此可以在线程池任务内部嵌套调用）。
+// 元素个数低于 sequential_threshold 或线程池只有一个线程时直接顺序执行
+struct ParallelOptions {
+    size_t grain_size = 0;                   // 每块的元素个数，0 表示按元素大小自动选择
+    size_t sequential_threshold = 1 << 15;   // 低于这个元素个数时不并行
+    SingletonThreadPool* pool = nullptr;     // 为空时使用默认线程池
+};
+
+namespace parallel_detail {
+
+inline SingletonThreadPool* default_pool() {
+    size_t threads = std::thread::hardware_concurrency();
+    return SingletonThreadPool::get_thread_pool(threads ? threads : 1);
+}
+
+// 一个块的元素区间
+struct Chunk {
+    size_t begin;
+    size_t end;
+};
+
+// 自动块大小：每块约 64 KiB，能放进 L2；块数不超过线程数的 8 倍，减少调度开销
+template <typename T>
+size_t grain_for(size_t n, const ParallelOptions& options, size_t threads) {
+    if (options.grain_size) return options.grain_size;
+    size_t grain = std::max<size_t>(64 * 1024 / sizeof(T), 1024);
+    size_t max_chunks = threads * 8;
+    return std::max(grain, (n + max_chunks - 1) / max_chunks);
+}
+
+// 并行执行 count 个任务 task(i)：i = 0 在调用线程上执行，其余提交到线程池。
+// 等所有任务结束后才返回，任一任务抛出的第一个异常在这里重新抛出
+template <typename Task>
+void run_tasks(SingletonThreadPool* pool, size_t count, Task&& task) {
+    if (count == 0) return;
+    std::vector<std::future<void>> futures;
+    futures.reserve(count - 1);
+    std::exception_ptr error;
+    try {
+        for (size_t i = 1; i < count; ++i) {
+            futures.push_back(pool->submit([&task, i] { task(i); }));
+        }
+        task(0);
+    } catch (...) {
+        error = std::current_exception();
+    }
+    for (auto& future : futures) {
+        // 帮忙执行队列中的任务，直到自己的任务完成
+        while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            if (!pool->run_pending_task()) {
+                future.wait();
+            }
+        }
+        try {
+            future.get();
+        } catch (...) {
+            if (!error) error = std::current_exception();
+        }
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+// 一次并行执行的切分方案：chunks 块，除最后一块外每块 grain 个元素
+struct Plan {
+    SingletonThreadPool* pool;
+    size_t n;
+    size_t grain;
+    size_t chunks;
+
+    [[nodiscard]] Chunk chunk(size_t i) const noexcept {
+        return Chunk{i * grain, std::min(n, (i + 1) * grain)};
+    }
+};
+
+// 元素太少或线程池只有一个线程时只切一块，由调用线程顺序执行
+template <typename T>
+Plan make_plan(size_t n, const ParallelOptions& options) {
+    SingletonThreadPool* pool = options.pool ? options.pool : default_pool();
+    size_t threads = pool->thread_count();
+    if (n < options.sequential_threshold || threads <= 1) {
+        return Plan{pool, n, n ? n : 1, n ? size_t(1) : size_t(0)};
+    }
+    size_t grain = grain_for<T>(n, options, threads);
+    return Plan{pool, n, grain, (n + grain - 1) / grain};
+}
+
+// 按方案并行执行 body(Chunk, chunk_index)
+template <typename Body>
+void for_each_chunk(const Plan& plan, Body&& body) {
+    if (plan.chunks == 1) {
+        body(plan.chunk(0), size_t(0));
+        return;
+    }
+    run_tasks(plan.pool, plan.chunks, [&](size_t i) { body(plan.chunk(i), i); });
+}
+
+// 两个有序区间归并结果中第 p 个位置之前来自 a 的元素个数（相等时优先取 a，与 std::merge 一致）
+template <typename T, typename Compare>
+size_t merge_split(const T* a, size_t a_len, const T* b, size_t b_len, size_t p, Compare& cmp) {
+    size_t lo = p > b_len ? p - b_len : 0;
+    size_t hi = std::min(p, a_len);
+    while (lo < hi) {
+        size_t i = lo + (hi - lo) / 2;
+        size_t j = p - i;
+        if (j > 0 && !cmp(b[j - 1], a[i])) {
+            lo = i + 1;
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+// 归并的一段工作：把 [a, a_end) 与 [b, b_end) 移动归并到 out
+template <typename T>
+struct MergePiece {
+    T* a;
+    T* a_end;
+    T* b;
+    T* b_end;
+    T* out;
+};
+
+} // namespace parallel_detail
+
+// 对每个元素调用 f(element)
+template <typename T, typename Alloc, typename F>
+void parallel_for_each(Vector<T, Alloc>& vec, F f, const ParallelOptions& options = {}) {
+    T* data = vec.data();
+    auto plan = parallel_detail::make_plan<T>(vec.size(), options);
+    parallel_detail::for_each_chunk(plan, [&](parallel_detail::Chunk chunk, size_t) {
+        for (size_t i = chunk.begin; i < chunk.end; ++i) {
+            f(data[i]);
+        }
+    });
+}
+
+// out[i] = f(in[i])，out 被调整为与 in 相同的大小；in 和 out 可以是同一个容器。
+// 新增的元素先默认构造再被赋值覆盖，因此 U 必须可以默认构造；平凡类型不会先清零
+template <typename T, typename AllocIn, typename U, typename AllocOut, typename F>
+void parallel_transform(const Vector<T, AllocIn>& in, Vector<U, AllocOut>& out, F f,
+                        const ParallelOptions& options = {}) {
+    size_t n = in.size();
+    if constexpr (std::is_trivial_v<U>) {
+        out.resize_for_overwrite(n);
+    } else {
+        out.resize(n);
+    }
+    const T* src = in.data();
+    U* dest = out.data();
+    auto plan = parallel_detail::make_plan<T>(n, options);
+    parallel_detail::for_each_chunk(plan, [&](parallel_detail::Chunk chunk, size_t) {
+        for (size_t i = chunk.begin; i < chunk.end; ++i) {
+            dest[i] = f(src[i]);
+        }
+    });
+}
+
+// 归约 transform(x) 的结果，等价于按下标顺序的 reduce(...reduce(reduce(init, transform(x0)), transform(x1))...)，
+// 与 std::transform_reduce 相同：transform 把元素变成 R，reduce 合并两个 R，必须满足结合律。
+// 累加类型与元素类型不同时（例如 int 元素累加到 double）用这个版本
+template <typename T, typename Alloc, typename R, typename Reduce, typename Transform>
+R parallel_transform_reduce(const Vector<T, Alloc>& vec, R init, Reduce reduce, Transform transform,
+                            const ParallelOptions& options = {}) {
+    size_t n = vec.size();
+    if (n == 0) return init;
+    const T* data = vec.data();
+    // 每块的部分结果以块内第一个元素的变换结果开始，不要求 reduce 有单位元
+    auto plan = parallel_detail::make_plan<T>(n, options);
+    std::vector<std::optional<R>> partial(plan.chunks);
+    parallel_detail::for_each_chunk(plan, [&](parallel_detail::Chunk chunk, size_t index) {
+        R acc = static_cast<R>(transform(data[chunk.begin]));
+        for (size_t i = chunk.begin + 1; i < chunk.end; ++i) {
+            acc = reduce(std::move(acc), transform(data[i]));
+        }
+        partial[index].emplace(std::move(acc));
+    });
+    for (auto& value : partial) {
+        init = reduce(std::move(init), std::move(*value));
+    }
+    return init;
+}
+
+// 用 op 归约所有元素，结果等价于按下标顺序的 op(...op(op(init, x0), x1)...)；op 必须满足结合律。
+// 部分结果之间也用 op 合并，所以 op 的两个参数和 init 都必须是元素类型
+template <typename T, typename Alloc, typename R, typename Op = std::plus<>>
+R parallel_reduce(const Vector<T, Alloc>& vec, R init, Op op = Op(), const ParallelOptions& options = {}) {
+    static_assert(std::is_same_v<R, T>,
+                  "parallel_reduce 的 init 必须与元素同类型，累加到其他类型请用 parallel_transform_reduce");
+    return parallel_transform_reduce(vec, std::move(init), op, [](const T& value) -> const T& { return value; },
+                                     options);
+}
+
+// 原地包含扫描：vec[i] = op(vec[0], ..., vec[i])。第一遍求各块总和，
+// 顺序求出块间前缀后，第二遍把前缀合并进每一块；op 必须满足结合律
+template <typename T, typename Alloc, typename Op = std::plus<>>
+void parallel_inclusive_scan(Vector<T, Alloc>& vec, Op op = Op(), const ParallelOptions& options = {}) {
+    size_t n = vec.size();
+    if (n == 0) return;
+    T* data = vec.data();
+    auto plan = parallel_detail::make_plan<T>(n, options);
+    // 第一遍：块内扫描，块的最后一个元素即块总和；只有一块时这就是全部工作
+    parallel_detail::for_each_chunk(plan, [&](parallel_detail::Chunk chunk, size_t) {
+        for (size_t j = chunk.begin + 1; j < chunk.end; ++j) {
+            data[j] = op(data[j - 1], data[j]);
+        }
+    });
+    // 块间前缀：carry[i] 是第 i 块之前所有元素的归约，第 0 块没有前缀
+    std::vector<std::optional<T>> carry(plan.chunks);
+    for (size_t i = 1; i < plan.chunks; ++i) {
+        const T& last = data[plan.chunk(i - 1).end - 1];
+        carry[i].emplace(carry[i - 1] ? op(*carry[i - 1], last) : last);
+    }
+    // 第二遍：第 0 块已经完成，其余块合并前缀
+    if (plan.chunks > 1) {
+        parallel_detail::run_tasks(plan.pool, plan.chunks - 1, [&](size_t i) {
+            auto chunk = plan.chunk(i + 1);
+            const T& prefix = *carry[i + 1];
+            for (size_t j = chunk.begin; j < chunk.end; ++j) {
+                data[j] = op(prefix, data[j]);
+            }
+        });
+    }
+}
+
+// 并行排序（不稳定）：各块并行 pdqsort，再逐轮两两归并；每轮按归并路径把输出
+// 切成等长的小段并行执行，最后几轮只有一两对有序区间时仍能用满所有线程
+template <typename T, typename Alloc, typename Compare = std::less<T>>
+void parallel_sort(Vector<T, Alloc>& vec, Compare cmp = Compare(), const ParallelOptions& options = {}) {
+    size_t n = vec.size();
+    T* data = vec.data();
+    auto plan = parallel_detail::make_plan<T>(n, options);
+    parallel_detail::for_each_chunk(plan, [&](parallel_detail::Chunk chunk, size_t) {
+        sort_detail::pdqsort(data + chunk.begin, data + chunk.end, cmp);
+    });
+    if (plan.chunks <= 1) return;
+    size_t grain = plan.grain;
+
+    // 归并缓冲区：与 vec 同样大小、使用同一个分配器，元素在两者之间来回移动
+    Vector<T, Alloc> buffer(vec.get_allocator());
+    buffer.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        buffer.emplace_back(std::move(data[i]));
+    }
+    T* src = buffer.data();
+    T* dst = data;
+    std::vector<parallel_detail::MergePiece<T>> pieces;
+    for (size_t width = grain; width < n; width *= 2) {
+        pieces.clear();
+        for (size_t lo = 0; lo < n; lo += 2 * width) {
+            size_t mid = std::min(n, lo + width);
+            size_t hi = std::min(n, lo + 2 * width);
+            T* a = src + lo;
+            T* b = src + mid;
+            size_t a_len = mid - lo;
+            size_t b_len = hi - mid;
+            // 按输出位置切段，每段在两个输入中的起点由 merge_split 二分得到
+            size_t prev_i = 0;
+            size_t prev_p = 0;
+            for (size_t p = std::min(grain, a_len + b_len); ; p = std::min(p + grain, a_len + b_len)) {
+                size_t i = parallel_detail::merge_split(a, a_len, b, b_len, p, cmp);
+                pieces.push_back({a + prev_i, a + i, b + (prev_p - prev_i), b + (p - i), dst + lo + prev_p});
+                prev_i = i;
+                prev_p = p;
+                if (p == a_len + b_len) break;
+            }
+        }
+        parallel_detail::run_tasks(plan.pool, pieces.size(), [&](size_t i) {
+            auto& piece = pieces[i];
+            std::merge(std::make_move_iterator(piece.a), std::make_move_iterator(piece.a_end),
+                       std::make_move_iterator(piece.b), std::make_move_iterator(piece.b_end),
+                       piece.out, cmp);
+        });
+        std::swap(src, dst);
+    }
+    // 最终结果在 buffer 中时搬回 vec
+    if (src != data) {
+        parallel_detail::for_each_chunk(plan, [&](parallel_detail::Chunk chunk, size_t) {
+            std::move(src + chunk.begin, src + chunk.end, data + chunk.begin);
+        });
+    }
+}
+
+// 返回第一个满足 pred 的元素，没有时返回 end()。找到之后，位于其后的块不再扫描
+template <typename T, typename Alloc, typename Pred>
+typename Vector<T, Alloc>::iterator parallel_find_if(Vector<T, Alloc>& vec, Pred pred,
+                                                     const ParallelOptions& options = {}) {
+    size_t n = vec.size();
+    const T* data = vec.data();
+    std::atomic<size_t> found(n);
+    auto plan = parallel_detail::make_plan<T>(n, options);
+    parallel_detail::for_each_chunk(plan, [&](parallel_detail::Chunk chunk, size_t) {
+        // 每 256 个元素检查一次是否已有更靠前的结果
+        for (size_t i = chunk.begin; i < chunk.end; ++i) {
+            if ((i & 255) == 0 && i >= found.load(std::memory_order_relaxed)) return;
+            if (pred(data[i])) {
+                size_t current = found.load(std::memory_order_relaxed);
+                while (i < current && !found.compare_exchange_weak(current, i, std::memory_order_relaxed)) {
+                }
+                return;
+            }
+        }
+    });
+    return vec.begin() + found.load(std::memory_order_relaxed);
+}
+
+#endif // PARALLEL_ALGORITHM_H
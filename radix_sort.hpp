@@ -0,0 +1,264 @@
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include "sort.hpp"
+
+// 连续内存上的基数排序，Vector/SmallVector 的 radix_sort/msd_radix_sort 转发到这里。
+// 键先转换成按无符号整数比较即可得到正确顺序的形式：
+//   - 有符号整数翻转符号位
+//   - 浮点数非负时翻转符号位、负数时按位取反（-0.0 排在 +0.0 之前，NaN 按符号位排在两端）
+// lsd_sort：从低字节到高字节逐字节计数排序，稳定，O(n * sizeof(key))；
+//   一次扫描得到所有字节的直方图，某个字节在所有键上都相同时跳过这一趟
+// msd_sort：从高字节开始的原地 American flag 排序，不稳定，不需要额外缓冲区，
+//   桶足够小时交给 pdqsort；除整数外还支持字节串键（std::string_view）
+namespace radix_detail {
+
+constexpr size_t radix = 256;
+// 元素少于这个数时基数排序的固定开销不划算，直接比较排序
+constexpr size_t lsd_threshold = 256;
+constexpr size_t msd_threshold = 64;
+
+template <typename K>
+concept integral_key = std::is_integral_v<K> && !std::is_same_v<K, bool>;
+
+template <typename K>
+concept radix_key = integral_key<K> || std::is_same_v<K, float> || std::is_same_v<K, double>;
+
+// 与 K 等宽的无符号整数
+template <typename K>
+using unsigned_key_t = std::conditional_t<sizeof(K) == 1, uint8_t,
+                       std::conditional_t<sizeof(K) == 2, uint16_t,
+                       std::conditional_t<sizeof(K) == 4, uint32_t, uint64_t>>>;
+
+template <radix_key K>
+unsigned_key_t<K> to_unsigned_key(K key) noexcept {
+    using U = unsigned_key_t<K>;
+    constexpr U sign_bit = U(1) << (sizeof(U) * 8 - 1);
+    if constexpr (std::is_floating_point_v<K>) {
+        U bits = std::bit_cast<U>(key);
+        return (bits & sign_bit) ? U(~bits) : U(bits | sign_bit);
+    } else if constexpr (std::is_signed_v<K>) {
+        return static_cast<U>(key) ^ sign_bit;
+    } else {
+        return key;
+    }
+}
+
+// 把 [first, last) 按 keys 的 LSD 基数排序搬运到最终位置。T 必须可平凡复制，
+// 中间结果在 first 与 buffer 之间来回复制
+template <typename T, typename U, typename KeyOf>
+void lsd_passes(T* first, size_t n, T* buffer, KeyOf& key_of) {
+    constexpr size_t passes = sizeof(U);
+    // 一次扫描统计所有字节的直方图
+    auto counts = std::make_unique<size_t[]>(passes * radix);
+    for (size_t i = 0; i < n; ++i) {
+        U key = key_of(first[i]);
+        for (size_t p = 0; p < passes; ++p) {
+            ++counts[p * radix + ((key >> (p * 8)) & 0xFF)];
+        }
+    }
+    T* src = first;
+    T* dst = buffer;
+    U first_key = key_of(first[0]);
+    for (size_t p = 0; p < passes; ++p) {
+        size_t* count = counts.get() + p * radix;
+        // 所有键这一字节相同：这一趟不会改变顺序
+        if (count[(first_key >> (p * 8)) & 0xFF] == n) continue;
+        size_t offsets[radix];
+        size_t sum = 0;
+        for (size_t b = 0; b < radix; ++b) {
+            offsets[b] = sum;
+            sum += count[b];
+        }
+        for (size_t i = 0; i < n; ++i) {
+            size_t b = (key_of(src[i]) >> (p * 8)) & 0xFF;
+            std::memcpy(static_cast<void*>(dst + offsets[b]++), static_cast<const void*>(src + i), sizeof(T));
+        }
+        std::swap(src, dst);
+    }
+    if (src != first) {
+        std::memcpy(static_cast<void*>(first), static_cast<const void*>(src), n * sizeof(T));
+    }
+}
+
+// 稳定的 LSD 基数排序，key(element) 返回算术类型的键
+template <typename T, typename KeyFn>
+void lsd_sort(T* first, T* last, KeyFn key) {
+    using K = std::remove_cvref_t<std::invoke_result_t<KeyFn&, const T&>>;
+    static_assert(radix_key<K>, "radix_sort 的键必须是整数或浮点数");
+    using U = unsigned_key_t<K>;
+    size_t n = last - first;
+    auto key_of = [&](const T& value) { return to_unsigned_key<K>(key(value)); };
+    if (n < lsd_threshold) {
+        sort_detail::stable_sort(first, last, [&](const T& a, const T& b) { return key_of(a) < key_of(b); });
+        return;
+    }
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        std::allocator<T> alloc;
+        T* buffer = alloc.allocate(n);
+        lsd_passes<T, U>(first, n, buffer, key_of);
+        alloc.deallocate(buffer, n);
+    } else {
+        // 非平凡类型：对 (键, 下标) 排序，再按结果把元素整体移动一次
+        struct Entry {
+            U key;
+            size_t index;
+        };
+        auto entries = std::make_unique<Entry[]>(n);
+        auto buffer = std::make_unique<Entry[]>(n);
+        for (size_t i = 0; i < n; ++i) {
+            entries[i] = Entry{key_of(first[i]), i};
+        }
+        auto entry_key = [](const Entry& e) { return e.key; };
+        lsd_passes<Entry, U>(entries.get(), n, buffer.get(), entry_key);
+        std::allocator<T> alloc;
+        T* sorted = alloc.allocate(n);
+        size_t built = 0;
+        try {
+            for (; built < n; ++built) {
+                ::new (static_cast<void*>(sorted + built)) T(std::move_if_noexcept(first[entries[built].index]));
+            }
+            std::move(sorted, sorted + n, first);
+        } catch (...) {
+            std::destroy(sorted, sorted + built);
+            alloc.deallocate(sorted, n);
+            throw;
+        }
+        std::destroy(sorted, sorted + n);
+        alloc.deallocate(sorted, n);
+    }
+}
+
+// MSD 排序的键访问：整数键按从高到低的字节，字节串键按字符（已结束的串落入 0 号桶）
+template <typename U>
+struct integer_digits {
+    static constexpr size_t buckets = radix;
+    static constexpr size_t max_depth = sizeof(U);
+    static size_t digit(U key, size_t depth) noexcept {
+        return (key >> ((sizeof(U) - 1 - depth) * 8)) & 0xFF;
+    }
+    static bool less(U a, U b) noexcept { return a < b; }
+};
+
+struct string_digits {
+    static constexpr size_t buckets = radix + 1;
+    static constexpr size_t max_depth = static_cast<size_t>(-1);
+    static size_t digit(std::string_view key, size_t depth) noexcept {
+        return depth < key.size() ? static_cast<unsigned char>(key[depth]) + 1 : 0;
+    }
+    static bool less(std::string_view a, std::string_view b) noexcept { return a < b; }
+};
+
+template <typename Digits, typename T, typename KeyOf>
+void msd_sort_impl(T* first, size_t n, size_t depth, KeyOf& key_of) {
+    constexpr size_t buckets = Digits::buckets;
+    while (true) {
+        if (n < msd_threshold) {
+            sort_detail::pdqsort(first, first + n, [&](const T& a, const T& b) {
+                return Digits::less(key_of(a), key_of(b));
+            });
+            return;
+        }
+        if (depth >= Digits::max_depth) return;
+        size_t count[buckets] = {};
+        for (size_t i = 0; i < n; ++i) {
+            ++count[Digits::digit(key_of(first[i]), depth)];
+        }
+        // 这一位全部相同时直接看下一位，不做任何移动
+        size_t only = Digits::digit(key_of(first[0]), depth);
+        if (count[only] == n) {
+            if (Digits::buckets > radix && only == 0) return;  // 所有串都已结束，彼此相等
+            ++depth;
+            continue;
+        }
+        // American flag：每个桶维护写入位置，把元素逐个交换到所属的桶
+        size_t head[buckets];
+        size_t tail[buckets];
+        size_t sum = 0;
+        for (size_t b = 0; b < buckets; ++b) {
+            head[b] = sum;
+            sum += count[b];
+            tail[b] = sum;
+        }
+        for (size_t b = 0; b < buckets; ++b) {
+            while (head[b] < tail[b]) {
+                size_t d = Digits::digit(key_of(first[head[b]]), depth);
+                if (d == b) {
+                    ++head[b];
+                } else {
+                    using std::swap;
+                    swap(first[head[b]], first[head[d]++]);
+                }
+            }
+        }
+        // 已结束的串（字节串的 0 号桶）彼此相等，不需要再排。只对较小的桶递归，
+        // 最大的桶留给外层循环继续处理：被递归的桶不超过 n / 2，栈深度不超过 log2(n)，
+        // 即使字节串逐层只分出一个元素（互为前缀的长串）也不会耗尽栈
+        size_t largest = buckets;
+        size_t largest_start = 0;
+        size_t start = 0;
+        for (size_t b = 0; b < buckets; ++b) {
+            size_t end = tail[b];
+            if (end - start > 1 && !(Digits::buckets > radix && b == 0)) {
+                if (largest == buckets || end - start > tail[largest] - largest_start) {
+                    largest = b;
+                    largest_start = start;
+                }
+            }
+            start = end;
+        }
+        start = 0;
+        for (size_t b = 0; b < buckets; ++b) {
+            size_t end = tail[b];
+            if (b != largest && end - start > 1 && !(Digits::buckets > radix && b == 0)) {
+                msd_sort_impl<Digits>(first + start, end - start, depth + 1, key_of);
+            }
+            start = end;
+        }
+        if (largest == buckets) return;
+        first += largest_start;
+        n = tail[largest] - largest_start;
+        ++depth;
+    }
+}
+
+// 不稳定的原地 MSD 基数排序。key(element) 返回算术类型，或可以转换为 std::string_view 的字节串
+template <typename T, typename KeyFn>
+void msd_sort(T* first, T* last, KeyFn key) {
+    using R = std::invoke_result_t<KeyFn&, const T&>;
+    using K = std::remove_cvref_t<R>;
+    size_t n = last - first;
+    if (n < 2) return;
+    if constexpr (radix_key<K>) {
+        auto key_of = [&](const T& value) { return to_unsigned_key<K>(key(value)); };
+        msd_sort_impl<integer_digits<unsigned_key_t<K>>>(first, n, 0, key_of);
+    } else {
+        static_assert(std::is_convertible_v<const K&, std::string_view>,
+                      "msd_radix_sort 的键必须是整数、浮点数或字节串");
+        // 按值返回的 std::string 在取得 string_view 后立即销毁
+        static_assert(std::is_lvalue_reference_v<R> || std::is_same_v<K, std::string_view> || std::is_pointer_v<K>,
+                      "msd_radix_sort 的字节串键必须以引用或 std::string_view 返回");
+        auto key_of = [&](const T& value) -> std::string_view { return key(value); };
+        msd_sort_impl<string_digits>(first, n, 0, key_of);
+    }
+}
+
+// 元素本身作为键
+struct identity_key {
+    template <typename T>
+    const T& operator()(const T& value) const noexcept {
+        return value;
+    }
+};
+
+} // namespace radix_detail
+
+#endif // RADIX_SORT_H
@@ -6,47 +6,437 @@
 #define SHARED_PTR_H
 #pragma once
 #include <iostream>
-#include <functional>
+#include <atomic>
+#include <cstddef>
+#include <new>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 
+// Reference-count policies. A control block keeps a strong and a weak count of the policy
+// type: increment() adds a reference, decrement() drops one and returns true for the last
+// reference, and increment_if_nonzero() is used by weak_ptr::lock to revive a strong owner.
+//
+// AtomicRefCount is safe to share across threads. Increments are relaxed because a new
+// owner can only be created from an existing one; the final decrement is acq_rel so every
+// write made through other owners happens-before the object is destroyed.
+struct AtomicRefCount {
+    std::atomic<size_t> count;
+
+    explicit AtomicRefCount(size_t n) noexcept : count(n) {}
+    void increment() noexcept { count.fetch_add(1, std::memory_order_relaxed); }
+    bool decrement() noexcept { return count.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+    bool increment_if_nonzero() noexcept {
+        size_t n = count.load(std::memory_order_relaxed);
+        while (n != 0) {
+            if (count.compare_exchange_weak(n, n + 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+    size_t load() const noexcept { return count.load(std::memory_order_relaxed); }
+};
+
+// LocalRefCount is a plain counter for object graphs confined to one thread.
+// Copying or releasing such pointers from several threads is a data race.
+struct LocalRefCount {
+    size_t count;
+
+    explicit LocalRefCount(size_t n) noexcept : count(n) {}
+    void increment() noexcept { ++count; }
+    bool decrement() noexcept { return --count == 0; }
+    bool increment_if_nonzero() noexcept {
+        if (count == 0) return false;
+        ++count;
+        return true;
+    }
+    size_t load() const noexcept { return count; }
+};
+
 // Forward declaration
-template <typename T>
+template <typename T, typename RefCount = AtomicRefCount>
 class shared_ptr;
+template <typename T, typename RefCount = AtomicRefCount>
+class weak_ptr;
+template <typename T, typename RefCount = AtomicRefCount>
+class enable_shared_from_this;
+template <typename T>
+class atomic_shared_ptr;
+
+// Single-threaded shared ownership
+template <typename T>
+using local_shared_ptr = shared_ptr<T, LocalRefCount>;
 
 
+// Type-erased control block. Concrete blocks know how to destroy the managed object
+// and how to free themselves, so the shared_ptr only stores a pointer to this base.
+// All strong owners together hold one weak reference: the object is destroyed when
+// ref_count reaches zero and the block is freed when weak_count reaches zero.
+template <typename RefCount>
 struct ControlBlock {
-    size_t ref_count;
-    void* ptr;
-    std::function<void(void*)> deleter;
+    RefCount ref_count;
+    RefCount weak_count;
 
-    ControlBlock() : ref_count(0), ptr(nullptr),
-                    deleter([](void*){}) {}
+    explicit ControlBlock(size_t n) noexcept : ref_count(n), weak_count(1) {}
+    ControlBlock(const ControlBlock&) = delete;
+    ControlBlock& operator=(const ControlBlock&) = delete;
 
-    ControlBlock(size_t ref_count, void* ptr)
-        : ref_count(ref_count), ptr(ptr),
-          deleter([](void* p) {}) {}
+    void release_strong() noexcept {
+        if (ref_count.decrement()) {
+            destroy_object();
+            release_weak();
+        }
+    }
+    void release_weak() noexcept {
+        if (weak_count.decrement()) {
+            destroy_block();
+        }
+    }
 
-    ControlBlock(size_t ref_count, void* ptr, std::function<void(void*)> d)
-        : ref_count(ref_count), ptr(ptr), deleter(std::move(d)) {}
+    // Called once the last owner is gone
+    virtual void destroy_object() noexcept = 0;
+    // Frees the block itself; the object has already been destroyed
+    virtual void destroy_block() noexcept = 0;
 
+protected:
     ~ControlBlock() = default;
 };
 
-template <typename T>
+// Slab pool for PointerControlBlock, the block used when shared_ptr adopts an existing
+// pointer. Blocks of one size class are carved from 64-block slabs that are never returned
+// to the system. Each thread keeps a private free list and exchanges 32-block batches with
+// the shared list under a mutex, so the common case takes no lock and no atomic RMW.
+// Define MYSTL_SHARED_PTR_NO_POOL to allocate every block with operator new.
+namespace shared_ptr_detail {
+
+constexpr size_t pool_granularity = alignof(std::max_align_t);
+constexpr size_t pool_max_block_size = 256;
+constexpr size_t pool_batch_size = 32;
+constexpr size_t pool_slab_blocks = 64;
+
+constexpr size_t pool_size_class(size_t size) noexcept {
+    return (size + pool_granularity - 1) / pool_granularity * pool_granularity;
+}
+
+// Blocks that are too large or over-aligned use operator new directly
+template <typename Block>
+constexpr bool pool_eligible = sizeof(Block) <= pool_max_block_size && alignof(Block) <= pool_granularity;
+
+// Counters of one thread cache. Only the owning thread writes them, with a relaxed load and
+// store rather than an RMW, so counting never touches a cache line shared with other threads
+struct CacheCounters {
+    std::atomic<size_t> allocations;
+    std::atomic<size_t> deallocations;
+    std::atomic<size_t> cache_hits;
+    CacheCounters* next;  // registry list link
+};
+
+// Counters of all live thread caches, plus the totals of caches whose thread has exited
+struct CounterRegistry {
+    std::mutex mutex;
+    CacheCounters* live = nullptr;
+    size_t allocations = 0;
+    size_t deallocations = 0;
+    size_t cache_hits = 0;
+};
+
+inline CounterRegistry& counter_registry() noexcept {
+    // Intentionally leaked, like the shared free lists
+    static CounterRegistry* registry = new CounterRegistry;
+    return *registry;
+}
+
+template <size_t Size>
+class SlabPool {
+    static_assert(Size >= sizeof(void*) && Size % pool_granularity == 0);
+
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    struct Shared {
+        std::mutex mutex;
+        FreeNode* free_list = nullptr;
+        size_t free_count = 0;
+        void* slabs = nullptr;  // each slab starts with a pointer to the previous one
+    };
+
+    // Trivially destructible so it stays usable while other thread_locals are destroyed
+    struct Cache {
+        FreeNode* free_list;
+        size_t free_count;
+        CacheCounters counters;
+        bool registered;
+        bool retired;  // the thread is exiting; blocks and counts go straight to the shared state
+    };
+
+    // Returns a thread's cached blocks to the shared list and folds its counters into the
+    // registry totals when the thread exits
+    struct CacheFlusher {
+        Cache& cache;
+        ~CacheFlusher() {
+            release_to_shared(cache, cache.free_count);
+            CounterRegistry& registry = counter_registry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.allocations += cache.counters.allocations.load(std::memory_order_relaxed);
+            registry.deallocations += cache.counters.deallocations.load(std::memory_order_relaxed);
+            registry.cache_hits += cache.counters.cache_hits.load(std::memory_order_relaxed);
+            for (CacheCounters** link = &registry.live; *link; link = &(*link)->next) {
+                if (*link == &cache.counters) {
+                    *link = cache.counters.next;
+                    break;
+                }
+            }
+            cache.retired = true;
+        }
+    };
+
+    static Shared& shared() noexcept {
+        // Intentionally leaked: blocks may be freed during static destruction
+        static Shared* pool = new Shared;
+        return *pool;
+    }
+
+    static Cache& local_cache() {
+        static thread_local constinit Cache cache{};
+        if (!cache.registered) {
+            cache.registered = true;
+            static thread_local CacheFlusher flusher{cache};
+            CounterRegistry& registry = counter_registry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            cache.counters.next = registry.live;
+            registry.live = &cache.counters;
+        }
+        return cache;
+    }
+
+    // Counts one event on the thread's own counter; once the thread is exiting its counters
+    // are no longer read, so the event goes to the registry total instead
+    static void count(Cache& cache, std::atomic<size_t>& counter, size_t& retired_total) noexcept {
+        if (cache.retired) {
+            std::lock_guard<std::mutex> lock(counter_registry().mutex);
+            ++retired_total;
+        } else {
+            counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    }
+
+    // Moves count blocks from the head of the thread list to the shared list
+    static void release_to_shared(Cache& cache, size_t count) noexcept {
+        if (count == 0) return;
+        FreeNode* first = cache.free_list;
+        FreeNode* last = first;
+        for (size_t i = 1; i < count; ++i) {
+            last = last->next;
+        }
+        cache.free_list = last->next;
+        cache.free_count -= count;
+        Shared& pool = shared();
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        last->next = pool.free_list;
+        pool.free_list = first;
+        pool.free_count += count;
+    }
+
+    // Fills an empty thread list with a batch from the shared list, or with a new slab
+    static void refill(Cache& cache) {
+        Shared& pool = shared();
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        if (pool.free_list) {
+            size_t count = pool.free_count < pool_batch_size ? pool.free_count : pool_batch_size;
+            FreeNode* first = pool.free_list;
+            FreeNode* last = first;
+            for (size_t i = 1; i < count; ++i) {
+                last = last->next;
+            }
+            pool.free_list = last->next;
+            pool.free_count -= count;
+            last->next = cache.free_list;
+            cache.free_list = first;
+            cache.free_count += count;
+            return;
+        }
+        // The first slot of a slab links the slab list, the rest become free blocks
+        auto* slab = static_cast<unsigned char*>(::operator new(Size * (pool_slab_blocks + 1)));
+        *reinterpret_cast<void**>(slab) = pool.slabs;
+        pool.slabs = slab;
+        for (size_t i = pool_slab_blocks; i > 0; --i) {
+            auto* node = reinterpret_cast<FreeNode*>(slab + i * Size);
+            node->next = cache.free_list;
+            cache.free_list = node;
+        }
+        cache.free_count += pool_slab_blocks;
+    }
+
+public:
+    static void* allocate() {
+        Cache& cache = local_cache();
+        CounterRegistry& registry = counter_registry();
+        if (cache.free_list) {
+            count(cache, cache.counters.cache_hits, registry.cache_hits);
+        } else {
+            refill(cache);
+        }
+        count(cache, cache.counters.allocations, registry.allocations);
+        FreeNode* node = cache.free_list;
+        cache.free_list = node->next;
+        --cache.free_count;
+        if (cache.retired) {
+            release_to_shared(cache, cache.free_count);
+        }
+        return node;
+    }
+
+    static void deallocate(void* p) noexcept {
+        Cache& cache = local_cache();
+        count(cache, cache.counters.deallocations, counter_registry().deallocations);
+        auto* node = static_cast<FreeNode*>(p);
+        node->next = cache.free_list;
+        cache.free_list = node;
+        ++cache.free_count;
+        if (cache.retired) {
+            release_to_shared(cache, cache.free_count);
+        } else if (cache.free_count > 2 * pool_batch_size) {
+            release_to_shared(cache, pool_batch_size);
+        }
+    }
+};
+
+} // namespace shared_ptr_detail
+
+// Snapshot of the control block pool counters
+struct ControlBlockPoolStats {
+    size_t live_blocks;
+    size_t allocations;
+    size_t cache_hits;  // allocations served from the thread's own free list
+
+    [[nodiscard]] double hit_rate() const noexcept {
+        return allocations ? static_cast<double>(cache_hits) / static_cast<double>(allocations) : 0.0;
+    }
+};
+
+// Sums the counters of every live thread cache and of threads that have exited
+inline ControlBlockPoolStats control_block_pool_stats() noexcept {
+    shared_ptr_detail::CounterRegistry& registry = shared_ptr_detail::counter_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    size_t allocations = registry.allocations;
+    size_t deallocations = registry.deallocations;
+    size_t cache_hits = registry.cache_hits;
+    for (shared_ptr_detail::CacheCounters* c = registry.live; c; c = c->next) {
+        allocations += c->allocations.load(std::memory_order_relaxed);
+        deallocations += c->deallocations.load(std::memory_order_relaxed);
+        cache_hits += c->cache_hits.load(std::memory_order_relaxed);
+    }
+    // A block freed on another thread may be counted before its allocation becomes visible
+    return {allocations > deallocations ? allocations - deallocations : 0, allocations, cache_hits};
+}
+
+// Block for an externally allocated object. An empty deleter such as
+// std::default_delete occupies no storage.
+template <typename T, typename RefCount, typename Deleter>
+struct PointerControlBlock final : ControlBlock<RefCount> {
+    T* ptr;
+    [[no_unique_address]] Deleter deleter;
+
+    PointerControlBlock(T* p, Deleter d) noexcept
+        : ControlBlock<RefCount>(1), ptr(p), deleter(std::move(d)) {}
+
+    void destroy_object() noexcept override { deleter(ptr); }
+    void destroy_block() noexcept override { delete this; }
+
+#ifndef MYSTL_SHARED_PTR_NO_POOL
+    static void* operator new(size_t size) {
+        if constexpr (shared_ptr_detail::pool_eligible<PointerControlBlock>) {
+            return shared_ptr_detail::SlabPool<shared_ptr_detail::pool_size_class(sizeof(PointerControlBlock))>::allocate();
+        } else {
+            return ::operator new(size);
+        }
+    }
+    static void operator delete(void* p) noexcept {
+        if constexpr (shared_ptr_detail::pool_eligible<PointerControlBlock>) {
+            shared_ptr_detail::SlabPool<shared_ptr_detail::pool_size_class(sizeof(PointerControlBlock))>::deallocate(p);
+        } else {
+            ::operator delete(p);
+        }
+    }
+#endif
+};
+
+// Block that embeds the object itself, used by make_shared/allocate_shared so the
+// object and its counts live in a single allocation obtained from Alloc.
+template <typename T, typename RefCount, typename Alloc>
+struct InplaceControlBlock final : ControlBlock<RefCount> {
+    using block_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<InplaceControlBlock>;
+    using block_traits = std::allocator_traits<block_allocator>;
+
+    [[no_unique_address]] block_allocator allocator;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    template <typename... Args>
+    explicit InplaceControlBlock(const Alloc& alloc, Args&&... args)
+        : ControlBlock<RefCount>(1), allocator(alloc) {
+        ::new (static_cast<void*>(storage)) T(std::forward<Args>(args)...);
+    }
+
+    T* object() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+
+    void destroy_object() noexcept override { object()->~T(); }
+    void destroy_block() noexcept override {
+        block_allocator alloc(std::move(allocator));
+        this->~InplaceControlBlock();
+        block_traits::deallocate(alloc, this, 1);
+    }
+
+    // Allocates the block and constructs the object in it
+    template <typename... Args>
+    static InplaceControlBlock* create(const Alloc& alloc, Args&&... args) {
+        block_allocator block_alloc(alloc);
+        InplaceControlBlock* block = block_traits::allocate(block_alloc, 1);
+        try {
+            ::new (static_cast<void*>(block)) InplaceControlBlock(alloc, std::forward<Args>(args)...);
+        } catch (...) {
+            block_traits::deallocate(block_alloc, block, 1);
+            throw;
+        }
+        return block;
+    }
+};
+
+template <typename T, typename RefCount>
 class shared_ptr {
-    ControlBlock* control_block;
+    ControlBlock<RefCount>* control_block;
     T* ptr;
     void release();
+    shared_ptr(ControlBlock<RefCount>* block, T* p) noexcept : control_block(block), ptr(p) {}
+    // Wraps p in a new PointerControlBlock; p is destroyed with d if that allocation fails
+    template <typename Deleter>
+    static ControlBlock<RefCount>* make_block(T* p, Deleter d);
+    // Points the weak_this of an enable_shared_from_this base at the new control block
+    template <typename U>
+    static void assign_weak_this(ControlBlock<RefCount>* block, const enable_shared_from_this<U, RefCount>* base) noexcept;
+    static void assign_weak_this(ControlBlock<RefCount>*, ...) noexcept {}
+
+    template <typename, typename>
+    friend class weak_ptr;
+    template <typename>
+    friend class atomic_shared_ptr;
 public:
     // Constructors
     shared_ptr() noexcept : control_block(nullptr), ptr(nullptr) {}
     explicit shared_ptr(T* p);
+    template <typename Deleter>
+    shared_ptr(T* p, Deleter d);
     shared_ptr(const shared_ptr& other) noexcept;
     shared_ptr(shared_ptr&& other) noexcept;
+    // Throws std::bad_weak_ptr if the object has already been destroyed
+    explicit shared_ptr(const weak_ptr<T, RefCount>& weak);
 
+    // Allocate the object and its control block together
     template <typename... Args>
-    static shared_ptr<T> make_shared(Args&&... args);
+    static shared_ptr make_shared(Args&&... args);
+    template <typename Alloc, typename... Args>
+    static shared_ptr allocate_shared(const Alloc& alloc, Args&&... args);
     // Destructor
     ~shared_ptr();
 
@@ -73,61 +463,99 @@ public:
 
 };
 
-template <typename T>
-shared_ptr<T>::shared_ptr(T* p) : control_block(new ControlBlock(1, p)), ptr(p) {}
+template <typename T, typename RefCount>
+template <typename Deleter>
+ControlBlock<RefCount>* shared_ptr<T, RefCount>::make_block(T* p, Deleter d) {
+    try {
+        return new PointerControlBlock<T, RefCount, Deleter>(p, d);
+    } catch (...) {
+        d(p);
+        throw;
+    }
+}
 
-template <typename T>
-shared_ptr<T>::shared_ptr(const shared_ptr& other) noexcept : control_block(other.control_block), ptr(other.ptr) {
+template <typename T, typename RefCount>
+template <typename U>
+void shared_ptr<T, RefCount>::assign_weak_this(ControlBlock<RefCount>* block,
+                                               const enable_shared_from_this<U, RefCount>* base) noexcept {
+    if (base && base->weak_this.expired()) {
+        U* object = static_cast<U*>(const_cast<enable_shared_from_this<U, RefCount>*>(base));
+        base->weak_this = weak_ptr<U, RefCount>(block, object);
+    }
+}
+
+template <typename T, typename RefCount>
+shared_ptr<T, RefCount>::shared_ptr(T* p) : control_block(make_block(p, std::default_delete<T>())), ptr(p) {
+    assign_weak_this(control_block, p);
+}
+
+template <typename T, typename RefCount>
+template <typename Deleter>
+shared_ptr<T, RefCount>::shared_ptr(T* p, Deleter d) : control_block(make_block(p, std::move(d))), ptr(p) {
+    assign_weak_this(control_block, p);
+}
+
+template <typename T, typename RefCount>
+shared_ptr<T, RefCount>::shared_ptr(const shared_ptr& other) noexcept : control_block(other.control_block), ptr(other.ptr) {
     if (control_block) {
-        control_block->ref_count++;
+        control_block->ref_count.increment();
     }
 }
-template <typename T>
-shared_ptr<T>::shared_ptr(shared_ptr&& other) noexcept : control_block(other.control_block), ptr(other.ptr) {
+template <typename T, typename RefCount>
+shared_ptr<T, RefCount>::shared_ptr(shared_ptr&& other) noexcept : control_block(other.control_block), ptr(other.ptr) {
     other.control_block = nullptr;
     other.ptr = nullptr;
 }
 
-template <typename T>
+template <typename T, typename RefCount>
+shared_ptr<T, RefCount>::shared_ptr(const weak_ptr<T, RefCount>& weak) : control_block(weak.control_block), ptr(weak.ptr) {
+    if (!control_block || !control_block->ref_count.increment_if_nonzero()) {
+        throw std::bad_weak_ptr();
+    }
+}
+
+template <typename T, typename RefCount>
 template <typename... Args>
-shared_ptr<T> shared_ptr<T>::make_shared(Args&&... args) {
-    return shared_ptr<T>(new T(std::forward<Args>(args)...));
+shared_ptr<T, RefCount> shared_ptr<T, RefCount>::make_shared(Args&&... args) {
+    return allocate_shared(std::allocator<T>(), std::forward<Args>(args)...);
 }
 
-template <typename T>
-shared_ptr<T>::~shared_ptr() {
+template <typename T, typename RefCount>
+template <typename Alloc, typename... Args>
+shared_ptr<T, RefCount> shared_ptr<T, RefCount>::allocate_shared(const Alloc& alloc, Args&&... args) {
+    auto* block = InplaceControlBlock<T, RefCount, Alloc>::create(alloc, std::forward<Args>(args)...);
+    assign_weak_this(block, block->object());
+    return shared_ptr(block, block->object());
+}
+
+template <typename T, typename RefCount>
+shared_ptr<T, RefCount>::~shared_ptr() {
     release();
 }
 
-template <typename T>
-void shared_ptr<T>::release() {
+template <typename T, typename RefCount>
+void shared_ptr<T, RefCount>::release() {
     if (control_block) {
-        control_block->ref_count--;
-        if (control_block->ref_count == 0) {
-            if (ptr) {
-                control_block->deleter(ptr);
-            }
-            delete control_block;
-        }
+        control_block->release_strong();
     }
 }
 
 
-template <typename T>
-shared_ptr<T>& shared_ptr<T>::operator=(const shared_ptr& other) noexcept {
+template <typename T, typename RefCount>
+shared_ptr<T, RefCount>& shared_ptr<T, RefCount>::operator=(const shared_ptr& other) noexcept {
     if (this != &other) {
         release();
         control_block = other.control_block;
         ptr = other.ptr;
         if (control_block) {
-            control_block->ref_count++;
+            control_block->ref_count.increment();
         }
     }
     return *this;
 }
 
-template <typename T>
-shared_ptr<T>& shared_ptr<T>::operator=(shared_ptr&& other) noexcept {
+template <typename T, typename RefCount>
+shared_ptr<T, RefCount>& shared_ptr<T, RefCount>::operator=(shared_ptr&& other) noexcept {
     if (this != &other) {
         release();
         control_block = other.control_block;
@@ -138,59 +566,200 @@ shared_ptr<T>& shared_ptr<T>::operator=(shared_ptr&& other) noexcept {
     return *this;
 }
 
-template <typename T>
-T& shared_ptr<T>::operator*() const { // Dereference operator
+template <typename T, typename RefCount>
+T& shared_ptr<T, RefCount>::operator*() const { // Dereference operator
     if (ptr == nullptr) {
         throw std::runtime_error("Attempting to dereference a null pointer");
     }
     return *ptr;
 }
 
-template <typename T>
-T* shared_ptr<T>::operator->() const { // Arrow operator for accessing members
+template <typename T, typename RefCount>
+T* shared_ptr<T, RefCount>::operator->() const { // Arrow operator for accessing members
     return ptr;
 }
 
-template <typename T>
-T* shared_ptr<T>::get() const noexcept {
+template <typename T, typename RefCount>
+T* shared_ptr<T, RefCount>::get() const noexcept {
     return ptr;
 }
 
-template <typename T>
-void shared_ptr<T>::reset(T* p) {
+template <typename T, typename RefCount>
+void shared_ptr<T, RefCount>::reset(T* p) {
+    ControlBlock<RefCount>* block = p ? make_block(p, std::default_delete<T>()) : nullptr;
     release();
+    control_block = block;
     ptr = p;
-    control_block = new ControlBlock(1, p,
-        [](void* p) { delete static_cast<T*>(p); });
+    assign_weak_this(control_block, p);
 }
 
-template <typename T>
-size_t shared_ptr<T>::use_count() const noexcept {
+template <typename T, typename RefCount>
+size_t shared_ptr<T, RefCount>::use_count() const noexcept {
     if(control_block) {
-        return control_block->ref_count;
+        return control_block->ref_count.load();
     }
     return 0;
 }
 
-template <typename T>
-bool shared_ptr<T>::operator==(const shared_ptr& other) const noexcept {
+template <typename T, typename RefCount>
+bool shared_ptr<T, RefCount>::operator==(const shared_ptr& other) const noexcept {
     return ptr == other.ptr;
 }
 
-template <typename T>
-bool shared_ptr<T>::operator!=(const shared_ptr& other) const noexcept {
+template <typename T, typename RefCount>
+bool shared_ptr<T, RefCount>::operator!=(const shared_ptr& other) const noexcept {
     return ptr != other.ptr;
 }
 
-template <typename T>
-shared_ptr<T>::operator bool() const noexcept {
+template <typename T, typename RefCount>
+shared_ptr<T, RefCount>::operator bool() const noexcept {
     return ptr != nullptr;
 }
 
-template <typename T>
-void shared_ptr<T>::swap(shared_ptr& other) noexcept {
+template <typename T, typename RefCount>
+void shared_ptr<T, RefCount>::swap(shared_ptr& other) noexcept {
     std::swap(control_block, other.control_block);
     std::swap(ptr, other.ptr);
 }
 
+// Non-owning observer of an object managed by shared_ptr. It keeps the control block
+// alive but not the object, so a cache can hold entries without pinning them.
+template <typename T, typename RefCount>
+class weak_ptr {
+    ControlBlock<RefCount>* control_block;
+    T* ptr;
+    weak_ptr(ControlBlock<RefCount>* block, T* p) noexcept;
+
+    template <typename, typename>
+    friend class shared_ptr;
+public:
+    // Constructors
+    weak_ptr() noexcept : control_block(nullptr), ptr(nullptr) {}
+    weak_ptr(const shared_ptr<T, RefCount>& shared) noexcept;
+    weak_ptr(const weak_ptr& other) noexcept;
+    weak_ptr(weak_ptr&& other) noexcept;
+    // Destructor
+    ~weak_ptr();
+
+    // Assignment operators
+    weak_ptr& operator=(const weak_ptr& other) noexcept;
+    weak_ptr& operator=(weak_ptr&& other) noexcept;
+    weak_ptr& operator=(const shared_ptr<T, RefCount>& shared) noexcept;
+
+    // Returns an owning pointer, or an empty one if the object has been destroyed
+    shared_ptr<T, RefCount> lock() const noexcept;
+    [[nodiscard]] bool expired() const noexcept;
+    [[nodiscard]] size_t use_count() const noexcept;
+    void reset() noexcept;
+
+    // Swap two weak pointers
+    void swap(weak_ptr& other) noexcept;
+};
+
+template <typename T, typename RefCount>
+weak_ptr<T, RefCount>::weak_ptr(ControlBlock<RefCount>* block, T* p) noexcept : control_block(block), ptr(p) {
+    if (control_block) {
+        control_block->weak_count.increment();
+    }
+}
+
+template <typename T, typename RefCount>
+weak_ptr<T, RefCount>::weak_ptr(const shared_ptr<T, RefCount>& shared) noexcept
+    : weak_ptr(shared.control_block, shared.ptr) {}
+
+template <typename T, typename RefCount>
+weak_ptr<T, RefCount>::weak_ptr(const weak_ptr& other) noexcept : weak_ptr(other.control_block, other.ptr) {}
+
+template <typename T, typename RefCount>
+weak_ptr<T, RefCount>::weak_ptr(weak_ptr&& other) noexcept : control_block(other.control_block), ptr(other.ptr) {
+    other.control_block = nullptr;
+    other.ptr = nullptr;
+}
+
+template <typename T, typename RefCount>
+weak_ptr<T, RefCount>::~weak_ptr() {
+    reset();
+}
+
+template <typename T, typename RefCount>
+weak_ptr<T, RefCount>& weak_ptr<T, RefCount>::operator=(const weak_ptr& other) noexcept {
+    weak_ptr(other).swap(*this);
+    return *this;
+}
+
+template <typename T, typename RefCount>
+weak_ptr<T, RefCount>& weak_ptr<T, RefCount>::operator=(weak_ptr&& other) noexcept {
+    weak_ptr(std::move(other)).swap(*this);
+    return *this;
+}
+
+template <typename T, typename RefCount>
+weak_ptr<T, RefCount>& weak_ptr<T, RefCount>::operator=(const shared_ptr<T, RefCount>& shared) noexcept {
+    weak_ptr(shared).swap(*this);
+    return *this;
+}
+
+template <typename T, typename RefCount>
+shared_ptr<T, RefCount> weak_ptr<T, RefCount>::lock() const noexcept {
+    if (control_block && control_block->ref_count.increment_if_nonzero()) {
+        return shared_ptr<T, RefCount>(control_block, ptr);
+    }
+    return shared_ptr<T, RefCount>();
+}
+
+template <typename T, typename RefCount>
+bool weak_ptr<T, RefCount>::expired() const noexcept {
+    return use_count() == 0;
+}
+
+template <typename T, typename RefCount>
+size_t weak_ptr<T, RefCount>::use_count() const noexcept {
+    return control_block ? control_block->ref_count.load() : 0;
+}
+
+template <typename T, typename RefCount>
+void weak_ptr<T, RefCount>::reset() noexcept {
+    if (control_block) {
+        control_block->release_weak();
+    }
+    control_block = nullptr;
+    ptr = nullptr;
+}
+
+template <typename T, typename RefCount>
+void weak_ptr<T, RefCount>::swap(weak_ptr& other) noexcept {
+    std::swap(control_block, other.control_block);
+    std::swap(ptr, other.ptr);
+}
+
+// Base class that lets an object managed by shared_ptr obtain further owning pointers
+// to itself. The weak reference is filled in when the first shared_ptr takes ownership.
+template <typename T, typename RefCount>
+class enable_shared_from_this {
+    mutable weak_ptr<T, RefCount> weak_this;
+
+    template <typename, typename>
+    friend class shared_ptr;
+protected:
+    enable_shared_from_this() noexcept = default;
+    // Copies start unowned: ownership belongs to the object, not its value
+    enable_shared_from_this(const enable_shared_from_this&) noexcept {}
+    enable_shared_from_this& operator=(const enable_shared_from_this&) noexcept { return *this; }
+    ~enable_shared_from_this() = default;
+public:
+    // Throws std::bad_weak_ptr if the object is not owned by a shared_ptr
+    shared_ptr<T, RefCount> shared_from_this();
+    weak_ptr<T, RefCount> weak_from_this() noexcept;
+};
+
+template <typename T, typename RefCount>
+shared_ptr<T, RefCount> enable_shared_from_this<T, RefCount>::shared_from_this() {
+    return shared_ptr<T, RefCount>(weak_this);
+}
+
+template <typename T, typename RefCount>
+weak_ptr<T, RefCount> enable_shared_from_this<T, RefCount>::weak_from_this() noexcept {
+    return weak_this;
+}
+
 #endif //SHARED_PTR_H
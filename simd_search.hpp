@@ -0,0 +1,547 @@
+#ifndef SIMD_SEARCH_H
+#define SIMD_SEARCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__)) && !defined(MYSTL_NO_SIMD)
+#define MYSTL_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+// 算术类型的线性查找内核：find / count / find_first_of / min_element / max_element。
+// x86 上按运行时检测到的指令集分派到 SSE2、AVX2 或 AVX-512BW 实现，
+// 其他平台、其他类型或定义了 MYSTL_NO_SIMD 时使用标量循环。
+//
+// 相等比较按位进行：整数的 == 与按位相等等价；浮点数只有 ±0 和 NaN 例外，
+// 查找前把 NaN 去掉（与任何值都不相等），把 0 展开为 +0 和 -0 两个位模式。
+namespace simd_detail {
+
+template <typename T>
+inline constexpr bool searchable =
+    std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+    (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+// 小于这个长度时直接用标量循环，省掉分派开销
+constexpr size_t simd_min_length = 16;
+// find_first_of 在 SIMD 路径上支持的最大键个数
+constexpr size_t max_simd_keys = 16;
+
+template <size_t Size>
+struct bits_of;
+template <> struct bits_of<1> { using type = uint8_t; };
+template <> struct bits_of<2> { using type = uint16_t; };
+template <> struct bits_of<4> { using type = uint32_t; };
+template <> struct bits_of<8> { using type = uint64_t; };
+
+template <typename T>
+using bits_t = typename bits_of<sizeof(T)>::type;
+
+template <typename T>
+bits_t<T> to_bits(T value) noexcept {
+    bits_t<T> bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    return bits;
+}
+
+// ---------------- 标量实现 ----------------
+
+// 标量内核同样按位比较，元素按原类型读取后再取位模式
+template <typename T>
+const T* scalar_find(const T* first, const T* last, bits_t<T> value) noexcept {
+    for (; first != last; ++first) {
+        if (to_bits(*first) == value) return first;
+    }
+    return last;
+}
+
+template <typename T>
+size_t scalar_count(const T* first, const T* last, bits_t<T> value) noexcept {
+    size_t n = 0;
+    for (; first != last; ++first) {
+        n += (to_bits(*first) == value);
+    }
+    return n;
+}
+
+template <typename T>
+const T* scalar_find_any(const T* first, const T* last, const bits_t<T>* keys, size_t key_count) noexcept {
+    for (; first != last; ++first) {
+        bits_t<T> bits = to_bits(*first);
+        for (size_t k = 0; k < key_count; ++k) {
+            if (bits == keys[k]) return first;
+        }
+    }
+    return last;
+}
+
+template <typename T, bool Max>
+const T* scalar_extreme(const T* first, const T* last) noexcept {
+    if (first == last) return last;
+    const T* best = first;
+    for (++first; first != last; ++first) {
+        if (Max ? (*best < *first) : (*first < *best)) best = first;
+    }
+    return best;
+}
+
+#ifdef MYSTL_SIMD_X86
+
+#define MYSTL_TARGET_SSE2 __attribute__((target("sse2")))
+#define MYSTL_TARGET_AVX2 __attribute__((target("avx2")))
+#define MYSTL_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+
+enum class Isa { scalar, sse2, avx2, avx512 };
+
+inline Isa detect_isa() noexcept {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return Isa::avx512;
+    if (__builtin_cpu_supports("avx2")) return Isa::avx2;
+    if (__builtin_cpu_supports("sse2")) return Isa::sse2;
+    return Isa::scalar;
+}
+
+inline Isa active_isa() noexcept {
+    static const Isa isa = detect_isa();
+    return isa;
+}
+
+// 每个指令集一组内核。掩码的粒度不同：SSE2/AVX2 的 movemask 每个字节一位，
+// 因此一个元素占 sizeof(U) 位；AVX-512 的比较直接产生每元素一位的掩码。
+
+struct Sse2 {
+    static constexpr size_t bytes = 16;
+
+    template <typename U>
+    MYSTL_TARGET_SSE2 static __m128i broadcast(U v) {
+        if constexpr (sizeof(U) == 1) return _mm_set1_epi8(static_cast<char>(v));
+        else if constexpr (sizeof(U) == 2) return _mm_set1_epi16(static_cast<short>(v));
+        else if constexpr (sizeof(U) == 4) return _mm_set1_epi32(static_cast<int>(v));
+        else return _mm_set1_epi64x(static_cast<long long>(v));
+    }
+
+    template <typename U>
+    MYSTL_TARGET_SSE2 static uint32_t eq_mask(__m128i a, __m128i b) {
+        __m128i eq;
+        if constexpr (sizeof(U) == 1) eq = _mm_cmpeq_epi8(a, b);
+        else if constexpr (sizeof(U) == 2) eq = _mm_cmpeq_epi16(a, b);
+        else if constexpr (sizeof(U) == 4) eq = _mm_cmpeq_epi32(a, b);
+        else {
+            // SSE2 没有 64 位比较：两个 32 位半部都相等才算相等
+            eq = _mm_cmpeq_epi32(a, b);
+            eq = _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+        return static_cast<uint32_t>(_mm_movemask_epi8(eq));
+    }
+
+    template <typename T>
+    MYSTL_TARGET_SSE2 static const T* find(const T* first, const T* last, bits_t<T> value) {
+        constexpr size_t lanes = bytes / sizeof(T);
+        const __m128i needle = broadcast(value);
+        for (; static_cast<size_t>(last - first) >= lanes; first += lanes) {
+            uint32_t mask = eq_mask<T>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), needle);
+            if (mask) return first + __builtin_ctz(mask) / sizeof(T);
+        }
+        return scalar_find(first, last, value);
+    }
+
+    template <typename T>
+    MYSTL_TARGET_SSE2 static size_t count(const T* first, const T* last, bits_t<T> value) {
+        constexpr size_t lanes = bytes / sizeof(T);
+        const __m128i needle = broadcast(value);
+        size_t bits = 0;
+        for (; static_cast<size_t>(last - first) >= lanes; first += lanes) {
+            bits += __builtin_popcount(eq_mask<T>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), needle));
+        }
+        return bits / sizeof(T) + scalar_count(first, last, value);
+    }
+
+    template <typename T>
+    MYSTL_TARGET_SSE2 static const T* find_any(const T* first, const T* last, const bits_t<T>* keys, size_t key_count) {
+        constexpr size_t lanes = bytes / sizeof(T);
+        __m128i needles[max_simd_keys];
+        for (size_t k = 0; k < key_count; ++k) needles[k] = broadcast(keys[k]);
+        for (; static_cast<size_t>(last - first) >= lanes; first += lanes) {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            uint32_t mask = 0;
+            for (size_t k = 0; k < key_count; ++k) mask |= eq_mask<T>(block, needles[k]);
+            if (mask) return first + __builtin_ctz(mask) / sizeof(T);
+        }
+        return scalar_find_any(first, last, keys, key_count);
+    }
+};
+
+struct Avx2 {
+    static constexpr size_t bytes = 32;
+
+    template <typename U>
+    MYSTL_TARGET_AVX2 static __m256i broadcast(U v) {
+        if constexpr (sizeof(U) == 1) return _mm256_set1_epi8(static_cast<char>(v));
+        else if constexpr (sizeof(U) == 2) return _mm256_set1_epi16(static_cast<short>(v));
+        else if constexpr (sizeof(U) == 4) return _mm256_set1_epi32(static_cast<int>(v));
+        else return _mm256_set1_epi64x(static_cast<long long>(v));
+    }
+
+    template <typename U>
+    MYSTL_TARGET_AVX2 static uint32_t eq_mask(__m256i a, __m256i b) {
+        __m256i eq;
+        if constexpr (sizeof(U) == 1) eq = _mm256_cmpeq_epi8(a, b);
+        else if constexpr (sizeof(U) == 2) eq = _mm256_cmpeq_epi16(a, b);
+        else if constexpr (sizeof(U) == 4) eq = _mm256_cmpeq_epi32(a, b);
+        else eq = _mm256_cmpeq_epi64(a, b);
+        return static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+    }
+
+    template <typename T>
+    MYSTL_TARGET_AVX2 static const T* find(const T* first, const T* last, bits_t<T> value) {
+        constexpr size_t lanes = bytes / sizeof(T);
+        const __m256i needle = broadcast(value);
+        for (; static_cast<size_t>(last - first) >= lanes; first += lanes) {
+            uint32_t mask = eq_mask<T>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)), needle);
+            if (mask) return first + __builtin_ctz(mask) / sizeof(T);
+        }
+        return scalar_find(first, last, value);
+    }
+
+    template <typename T>
+    MYSTL_TARGET_AVX2 static size_t count(const T* first, const T* last, bits_t<T> value) {
+        constexpr size_t lanes = bytes / sizeof(T);
+        const __m256i needle = broadcast(value);
+        size_t bits = 0;
+        for (; static_cast<size_t>(last - first) >= lanes; first += lanes) {
+            bits += __builtin_popcount(eq_mask<T>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)), needle));
+        }
+        return bits / sizeof(T) + scalar_count(first, last, value);
+    }
+
+    template <typename T>
+    MYSTL_TARGET_AVX2 static const T* find_any(const T* first, const T* last, const bits_t<T>* keys, size_t key_count) {
+        constexpr size_t lanes = bytes / sizeof(T);
+        __m256i needles[max_simd_keys];
+        for (size_t k = 0; k < key_count; ++k) needles[k] = broadcast(keys[k]);
+        for (; static_cast<size_t>(last - first) >= lanes; first += lanes) {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            uint32_t mask = 0;
+            for (size_t k = 0; k < key_count; ++k) mask |= eq_mask<T>(block, needles[k]);
+            if (mask) return first + __builtin_ctz(mask) / sizeof(T);
+        }
+        return scalar_find_any(first, last, keys, key_count);
+    }
+
+    // AVX2 只有 8/16/32 位整数的 min/max
+    template <typename T>
+    static constexpr bool has_minmax = std::is_integral_v<T> && sizeof(T) <= 4;
+
+    template <typename T, bool Max>
+    MYSTL_TARGET_AVX2 static __m256i minmax(__m256i a, __m256i b) {
+        constexpr bool s = std::is_signed_v<T>;
+        if constexpr (sizeof(T) == 1) {
+            if constexpr (Max) return s ? _mm256_max_epi8(a, b) : _mm256_max_epu8(a, b);
+            else return s ? _mm256_min_epi8(a, b) : _mm256_min_epu8(a, b);
+        } else if constexpr (sizeof(T) == 2) {
+            if constexpr (Max) return s ? _mm256_max_epi16(a, b) : _mm256_max_epu16(a, b);
+            else return s ? _mm256_min_epi16(a, b) : _mm256_min_epu16(a, b);
+        } else {
+            if constexpr (Max) return s ? _mm256_max_epi32(a, b) : _mm256_max_epu32(a, b);
+            else return s ? _mm256_min_epi32(a, b) : _mm256_min_epu32(a, b);
+        }
+    }
+
+    // 返回 [first, last) 的最小（最大）值，要求区间长度不小于一个寄存器
+    template <typename T, bool Max>
+    MYSTL_TARGET_AVX2 static T extreme_value(const T* first, const T* last) {
+        constexpr size_t lanes = bytes / sizeof(T);
+        __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        for (first += lanes; static_cast<size_t>(last - first) >= lanes; first += lanes) {
+            acc = minmax<T, Max>(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)));
+        }
+        alignas(32) T lanes_out[lanes];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes_out), acc);
+        T best = lanes_out[0];
+        for (size_t i = 1; i < lanes; ++i) best = Max ? (best < lanes_out[i] ? lanes_out[i] : best)
+                                                      : (lanes_out[i] < best ? lanes_out[i] : best);
+        for (; first != last; ++first) best = Max ? (best < *first ? *first : best)
+                                                  : (*first < best ? *first : best);
+        return best;
+    }
+};
+
+struct Avx512 {
+    static constexpr size_t bytes = 64;
+
+    template <typename U>
+    MYSTL_TARGET_AVX512 static __m512i broadcast(U v) {
+        if constexpr (sizeof(U) == 1) return _mm512_set1_epi8(static_cast<char>(v));
+        else if constexpr (sizeof(U) == 2) return _mm512_set1_epi16(static_cast<short>(v));
+        else if constexpr (sizeof(U) == 4) return _mm512_set1_epi32(static_cast<int>(v));
+        else return _mm512_set1_epi64(static_cast<long long>(v));
+    }
+
+    template <typename U>
+    MYSTL_TARGET_AVX512 static uint64_t eq_mask(__m512i a, __m512i b) {
+        if constexpr (sizeof(U) == 1) return _mm512_cmpeq_epi8_mask(a, b);
+        else if constexpr (sizeof(U) == 2) return _mm512_cmpeq_epi16_mask(a, b);
+        else if constexpr (sizeof(U) == 4) return _mm512_cmpeq_epi32_mask(a, b);
+        else return _mm512_cmpeq_epi64_mask(a, b);
+    }
+
+    template <typename T>
+    MYSTL_TARGET_AVX512 static const T* find(const T* first, const T* last, bits_t<T> value) {
+        constexpr size_t lanes = bytes / sizeof(T);
+        const __m512i needle = broadcast(value);
+        for (; static_cast<size_t>(last - first) >= lanes; first += lanes) {
+            uint64_t mask = eq_mask<T>(_mm512_loadu_si512(first), needle);
+            if (mask) return first + __builtin_ctzll(mask);
+        }
+        return scalar_find(first, last, value);
+    }
+
+    template <typename T>
+    MYSTL_TARGET_AVX512 static size_t count(const T* first, const T* last, bits_t<T> value) {
+        constexpr size_t lanes = bytes / sizeof(T);
+        const __m512i needle = broadcast(value);
+        size_t n = 0;
+        for (; static_cast<size_t>(last - first) >= lanes; first += lanes) {
+            n += __builtin_popcountll(eq_mask<T>(_mm512_loadu_si512(first), needle));
+        }
+        return n + scalar_count(first, last, value);
+    }
+
+    template <typename T>
+    MYSTL_TARGET_AVX512 static const T* find_any(const T* first, const T* last, const bits_t<T>* keys, size_t key_count) {
+        constexpr size_t lanes = bytes / sizeof(T);
+        __m512i needles[max_simd_keys];
+        for (size_t k = 0; k < key_count; ++k) needles[k] = broadcast(keys[k]);
+        for (; static_cast<size_t>(last - first) >= lanes; first += lanes) {
+            const __m512i block = _mm512_loadu_si512(first);
+            uint64_t mask = 0;
+            for (size_t k = 0; k < key_count; ++k) mask |= eq_mask<T>(block, needles[k]);
+            if (mask) return first + __builtin_ctzll(mask);
+        }
+        return scalar_find_any(first, last, keys, key_count);
+    }
+
+    template <typename T>
+    static constexpr bool has_minmax = std::is_integral_v<T>;
+
+    // GCC 12 的无掩码 min/max 以未初始化的寄存器作为源操作数，-O2 -Wall 下报 -Wmaybe-uninitialized；
+    // 统一改用所有通道都有效的掩码版本（源为 a），结果相同
+    template <typename T, bool Max>
+    MYSTL_TARGET_AVX512 static __m512i minmax(__m512i a, __m512i b) {
+        constexpr bool s = std::is_signed_v<T>;
+        if constexpr (sizeof(T) == 1) {
+            constexpr __mmask64 all = ~__mmask64(0);
+            if constexpr (Max) return s ? _mm512_mask_max_epi8(a, all, a, b) : _mm512_mask_max_epu8(a, all, a, b);
+            else return s ? _mm512_mask_min_epi8(a, all, a, b) : _mm512_mask_min_epu8(a, all, a, b);
+        } else if constexpr (sizeof(T) == 2) {
+            constexpr __mmask32 all = ~__mmask32(0);
+            if constexpr (Max) return s ? _mm512_mask_max_epi16(a, all, a, b) : _mm512_mask_max_epu16(a, all, a, b);
+            else return s ? _mm512_mask_min_epi16(a, all, a, b) : _mm512_mask_min_epu16(a, all, a, b);
+        } else if constexpr (sizeof(T) == 4) {
+            constexpr __mmask16 all = 0xFFFF;
+            if constexpr (Max) return s ? _mm512_mask_max_epi32(a, all, a, b) : _mm512_mask_max_epu32(a, all, a, b);
+            else return s ? _mm512_mask_min_epi32(a, all, a, b) : _mm512_mask_min_epu32(a, all, a, b);
+        } else {
+            constexpr __mmask8 all = 0xFF;
+            if constexpr (Max) return s ? _mm512_mask_max_epi64(a, all, a, b) : _mm512_mask_max_epu64(a, all, a, b);
+            else return s ? _mm512_mask_min_epi64(a, all, a, b) : _mm512_mask_min_epu64(a, all, a, b);
+        }
+    }
+
+    template <typename T, bool Max>
+    MYSTL_TARGET_AVX512 static T extreme_value(const T* first, const T* last) {
+        constexpr size_t lanes = bytes / sizeof(T);
+        __m512i acc = _mm512_loadu_si512(first);
+        for (first += lanes; static_cast<size_t>(last - first) >= lanes; first += lanes) {
+            acc = minmax<T, Max>(acc, _mm512_loadu_si512(first));
+        }
+        alignas(64) T lanes_out[lanes];
+        _mm512_store_si512(lanes_out, acc);
+        T best = lanes_out[0];
+        for (size_t i = 1; i < lanes; ++i) best = Max ? (best < lanes_out[i] ? lanes_out[i] : best)
+                                                      : (lanes_out[i] < best ? lanes_out[i] : best);
+        for (; first != last; ++first) best = Max ? (best < *first ? *first : best)
+                                                  : (*first < best ? *first : best);
+        return best;
+    }
+};
+
+#undef MYSTL_TARGET_SSE2
+#undef MYSTL_TARGET_AVX2
+#undef MYSTL_TARGET_AVX512
+
+template <typename T>
+const T* dispatch_find(const T* first, const T* last, bits_t<T> value) {
+    switch (active_isa()) {
+        case Isa::avx512: return Avx512::find(first, last, value);
+        case Isa::avx2: return Avx2::find(first, last, value);
+        case Isa::sse2: return Sse2::find(first, last, value);
+        default: return scalar_find(first, last, value);
+    }
+}
+
+template <typename T>
+size_t dispatch_count(const T* first, const T* last, bits_t<T> value) {
+    switch (active_isa()) {
+        case Isa::avx512: return Avx512::count(first, last, value);
+        case Isa::avx2: return Avx2::count(first, last, value);
+        case Isa::sse2: return Sse2::count(first, last, value);
+        default: return scalar_count(first, last, value);
+    }
+}
+
+template <typename T>
+const T* dispatch_find_any(const T* first, const T* last, const bits_t<T>* keys, size_t key_count) {
+    switch (active_isa()) {
+        case Isa::avx512: return Avx512::find_any(first, last, keys, key_count);
+        case Isa::avx2: return Avx2::find_any(first, last, keys, key_count);
+        case Isa::sse2: return Sse2::find_any(first, last, keys, key_count);
+        default: return scalar_find_any(first, last, keys, key_count);
+    }
+}
+
+#else
+
+template <typename T>
+const T* dispatch_find(const T* first, const T* last, bits_t<T> value) {
+    return scalar_find(first, last, value);
+}
+
+template <typename T>
+size_t dispatch_count(const T* first, const T* last, bits_t<T> value) {
+    return scalar_count(first, last, value);
+}
+
+template <typename T>
+const T* dispatch_find_any(const T* first, const T* last, const bits_t<T>* keys, size_t key_count) {
+    return scalar_find_any(first, last, keys, key_count);
+}
+
+#endif // MYSTL_SIMD_X86
+
+// 把要查找的值转换为需要匹配的位模式，返回模式个数（0 表示不可能匹配）
+template <typename T>
+size_t equality_patterns(T value, bits_t<T>* out) noexcept {
+    if constexpr (std::is_floating_point_v<T>) {
+        if (std::isnan(value)) return 0;
+        if (value == T(0)) {
+            out[0] = to_bits(T(0.0));
+            out[1] = to_bits(T(-0.0));
+            return 2;
+        }
+    }
+    out[0] = to_bits(value);
+    return 1;
+}
+
+// ---------------- 对外接口 ----------------
+
+template <typename T>
+const T* find(const T* first, const T* last, T value) noexcept {
+    using U = bits_t<T>;
+    if (static_cast<size_t>(last - first) < simd_min_length) {
+        for (; first != last; ++first) {
+            if (*first == value) return first;
+        }
+        return last;
+    }
+    U patterns[2];
+    size_t n = equality_patterns(value, patterns);
+    if (n == 1) return dispatch_find(first, last, patterns[0]);
+    if (n == 2) return dispatch_find_any(first, last, patterns, 2);
+    return last;
+}
+
+template <typename T>
+size_t count(const T* first, const T* last, T value) noexcept {
+    using U = bits_t<T>;
+    if (static_cast<size_t>(last - first) < simd_min_length) {
+        size_t n = 0;
+        for (; first != last; ++first) n += (*first == value);
+        return n;
+    }
+    U patterns[2];
+    size_t n = equality_patterns(value, patterns);
+    size_t total = 0;
+    for (size_t i = 0; i < n; ++i) {
+        total += dispatch_count(first, last, patterns[i]);
+    }
+    return total;
+}
+
+template <typename T>
+const T* find_first_of(const T* first, const T* last, const T* keys, size_t key_count) noexcept {
+    using U = bits_t<T>;
+    U patterns[max_simd_keys];
+    size_t pattern_count = 0;
+    bool fits = true;
+    for (size_t k = 0; k < key_count; ++k) {
+        U key_patterns[2];
+        size_t n = equality_patterns(keys[k], key_patterns);
+        if (pattern_count + n > max_simd_keys) {
+            fits = false;
+            break;
+        }
+        for (size_t i = 0; i < n; ++i) patterns[pattern_count++] = key_patterns[i];
+    }
+    if (!fits || static_cast<size_t>(last - first) < simd_min_length) {
+        for (; first != last; ++first) {
+            for (size_t k = 0; k < key_count; ++k) {
+                if (*first == keys[k]) return first;
+            }
+        }
+        return last;
+    }
+    if (pattern_count == 0) return last;
+    return dispatch_find_any(first, last, patterns, pattern_count);
+}
+
+// 与 std::min_element / std::max_element 一致，返回第一个最小（最大）元素。
+// 整数先用 SIMD 求出极值，再用 find 定位；浮点数因 NaN 的比较语义走标量
+template <typename T, bool Max>
+const T* extreme_element(const T* first, const T* last) noexcept {
+#ifdef MYSTL_SIMD_X86
+    if constexpr (std::is_integral_v<T>) {
+        size_t length = static_cast<size_t>(last - first);
+        if (length >= simd_min_length) {
+            switch (active_isa()) {
+                case Isa::avx512:
+                    if constexpr (Avx512::has_minmax<T>) {
+                        if (length >= Avx512::bytes / sizeof(T)) {
+                            return find(first, last, Avx512::extreme_value<T, Max>(first, last));
+                        }
+                    }
+                    break;
+                case Isa::avx2:
+                    if constexpr (Avx2::has_minmax<T>) {
+                        if (length >= Avx2::bytes / sizeof(T)) {
+                            return find(first, last, Avx2::extreme_value<T, Max>(first, last));
+                        }
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+#endif
+    return scalar_extreme<T, Max>(first, last);
+}
+
+template <typename T>
+const T* min_element(const T* first, const T* last) noexcept {
+    return extreme_element<T, false>(first, last);
+}
+
+template <typename T>
+const T* max_element(const T* first, const T* last) noexcept {
+    return extreme_element<T, true>(first, last);
+}
+
+} // namespace simd_detail
+
+#endif // SIMD_SEARCH_H
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <functional>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include "function.hpp"
+
+class SingletonThreadPool {
+
+    std::vector<std::thread> workers;
+    // 任务只需要移动，packaged_task 直接存进 MoveOnlyFunction 的内联缓冲区
+    std::queue<MoveOnlyFunction<void()>> tasks;
+    std::mutex queue_mutex;
+    std::condition_variable condition;
+    std::atomic<bool> stop;
+    explicit SingletonThreadPool(size_t threads) : stop(false) {
+        for (size_t i = 0; i < threads; ++i) {
+            workers.emplace_back([this] {
+                while (true) {
+                    MoveOnlyFunction<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(this->queue_mutex);
+                        this->condition.wait(lock, [this] {
+                            return this->stop.load() || !this->tasks.empty();
+                        });
+                        if (this->stop.load() && this->tasks.empty())
+                            return;
+                        task = std::move(this->tasks.front());
+                        this->tasks.pop();
+                    }
+                    task();
+                }
+            });
+        }
+    }
+
+
+public:
+    SingletonThreadPool& operator= (const SingletonThreadPool &) = delete;
+    SingletonThreadPool(const SingletonThreadPool &) = delete;
+    SingletonThreadPool(SingletonThreadPool &&) = delete;
+    SingletonThreadPool& operator= (SingletonThreadPool &&) = delete;
+
+    ~SingletonThreadPool() {
+        stop.store(true);
+        condition.notify_all();
+        for (std::thread &worker : workers)
+            if (worker.joinable())
+                worker.join();
+    }
+    
+    static SingletonThreadPool* get_thread_pool(size_t threads) {
+        static std::unique_ptr<SingletonThreadPool> ptr(new SingletonThreadPool(threads));
+        return ptr.get();
+    }
+
+    [[nodiscard]] size_t thread_count() const noexcept {
+        return workers.size();
+    }
+
+    // 在调用线程上执行一个排队中的任务，队列为空时返回 false。
+    // 等待子任务的线程（包括工作线程自己）借此帮忙，嵌套提交任务时不会因为线程全部阻塞而死锁
+    bool run_pending_task() {
+        MoveOnlyFunction<void()> task;
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            if (tasks.empty())
+                return false;
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
+        task();
+        return true;
+    }
+
+    template<class F, class... Args>
+    auto submit(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>> {
+        using return_type = std::invoke_result_t<F, Args...>;
+
+        std::packaged_task<return_type()> task(
+            std::bind(std::forward<F>(f), std::forward<Args>(args)...)
+        );
+
+        std::future<return_type> res = task.get_future();
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            if (stop.load())
+                throw std::runtime_error("submit on stopped ThreadPool");
+            tasks.emplace(std::move(task));
+        }
+        condition.notify_one();
+        return res;
+    }
+};
@@ -0,0 +1,601 @@
+#ifndef SOA_VECTOR_H
+#define SOA_VECTOR_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "vector.hpp"
+#include "sort.hpp"
+
+// 列式存储（structure of arrays）的向量：每个字段单独存放在一段连续内存中，
+// 只访问一两个字段的热循环不再把整条记录读进缓存。增长策略、元素的构造/搬运/销毁
+// 与 Vector 共用 vector_detail 中的实现；按行访问时返回由各字段引用组成的 std::tuple
+namespace soa_detail {
+
+// 按下标访问所属容器的随机访问迭代器，解引用得到行代理（引用组成的 tuple）
+template <typename Container, typename Reference>
+class soa_iterator {
+    Container* container;
+    size_t index;
+public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = typename std::remove_const_t<Container>::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = Reference;
+
+    soa_iterator() noexcept : container(nullptr), index(0) {}
+    soa_iterator(Container* container, size_t index) noexcept : container(container), index(index) {}
+    // 非常量迭代器可以隐式转换为常量迭代器
+    template <typename C, typename R>
+        requires (!std::is_same_v<C, Container> && std::is_convertible_v<C*, Container*>)
+    soa_iterator(const soa_iterator<C, R>& other) noexcept : container(other.owner()), index(other.position()) {}
+
+    [[nodiscard]] Container* owner() const noexcept { return container; }
+    [[nodiscard]] size_t position() const noexcept { return index; }
+
+    Reference operator*() const { return container->row(index); }
+    Reference operator[](difference_type n) const { return container->row(index + n); }
+    soa_iterator& operator++() noexcept { ++index; return *this; }
+    soa_iterator operator++(int) noexcept { soa_iterator tmp = *this; ++index; return tmp; }
+    soa_iterator& operator--() noexcept { --index; return *this; }
+    soa_iterator operator--(int) noexcept { soa_iterator tmp = *this; --index; return tmp; }
+    soa_iterator& operator+=(difference_type n) noexcept { index += n; return *this; }
+    soa_iterator& operator-=(difference_type n) noexcept { index -= n; return *this; }
+    friend soa_iterator operator+(soa_iterator it, difference_type n) noexcept { return it += n; }
+    friend soa_iterator operator+(difference_type n, soa_iterator it) noexcept { return it += n; }
+    friend soa_iterator operator-(soa_iterator it, difference_type n) noexcept { return it -= n; }
+    friend difference_type operator-(const soa_iterator& a, const soa_iterator& b) noexcept {
+        return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+    }
+    friend bool operator==(const soa_iterator& a, const soa_iterator& b) noexcept { return a.index == b.index; }
+    friend auto operator<=>(const soa_iterator& a, const soa_iterator& b) noexcept { return a.index <=> b.index; }
+};
+
+} // namespace soa_detail
+
+template <typename... Fields>
+class SoAVector {
+    static_assert(sizeof...(Fields) > 0, "SoAVector 至少需要一个字段");
+
+    template <size_t I>
+    using field_t = std::tuple_element_t<I, std::tuple<Fields...>>;
+    template <size_t I>
+    using field_alloc = std::allocator<field_t<I>>;
+    template <size_t I>
+    using field_traits = std::allocator_traits<field_alloc<I>>;
+    using field_indices = std::index_sequence_for<Fields...>;
+
+    std::tuple<Fields*...> columns;
+    size_t soa_size;
+    size_t soa_capacity;
+    [[no_unique_address]] std::tuple<std::allocator<Fields>...> allocators;
+
+    template <size_t I>
+    field_alloc<I>& allocator_for() noexcept { return std::get<I>(allocators); }
+    // 搬到新内存（扩容、重排）时一列失败不能影响已经搬完的列：所有列的移动构造都不抛异常时
+    // 才移动，否则可以拷贝的列都改为拷贝，失败时旧内容完好。不可拷贝且移动可能抛异常的列只能移动
+    static constexpr bool nothrow_move_rows = (std::is_nothrow_move_constructible_v<Fields> && ...);
+    template <size_t I>
+    static constexpr bool transfer_by_move = nothrow_move_rows || !std::is_copy_constructible_v<field_t<I>>;
+    template <size_t I>
+    static decltype(auto) transfer_source(field_t<I>& value) noexcept {
+        if constexpr (transfer_by_move<I>) {
+            return std::move(value);
+        } else {
+            return std::as_const(value);
+        }
+    }
+    // 下一次扩容的目标容量，与 Vector 相同：0 -> 1，之后翻倍
+    [[nodiscard]] size_t next_capacity() const noexcept;
+    // 换用容量为 new_capacity 的新内存：先分配所有列，再逐列搬运，
+    // 全部成功后才销毁旧内容，失败时原样保留
+    void reallocate(size_t new_capacity);
+    template <size_t... I>
+    void reallocate_columns(size_t new_capacity, std::index_sequence<I...>);
+    // 销毁 [first, last) 行
+    template <size_t... I>
+    void destroy_rows(size_t first, size_t last, std::index_sequence<I...>) noexcept;
+    template <size_t... I>
+    void deallocate_columns(std::index_sequence<I...>) noexcept;
+    // 在第 index 行逐列构造，某一列失败时销毁已构造的列
+    template <size_t... I, typename... Args>
+    void construct_row(size_t index, std::index_sequence<I...>, Args&&... args);
+    template <size_t... I>
+    void value_construct_rows(size_t first, size_t last, std::index_sequence<I...>);
+    template <size_t... I>
+    void erase_rows(size_t index, size_t n, std::index_sequence<I...>);
+    // 按 order 重排所有列：新第 i 行是原第 order[i] 行，与扩容相同地先分配再搬运
+    template <size_t... I>
+    void apply_permutation(const size_t* order, std::index_sequence<I...>);
+    template <size_t... I>
+    auto make_row(size_t index, std::index_sequence<I...>) noexcept;
+    template <size_t... I>
+    auto make_row(size_t index, std::index_sequence<I...>) const noexcept;
+
+public:
+    using value_type = std::tuple<Fields...>;
+    using reference = std::tuple<Fields&...>;
+    using const_reference = std::tuple<const Fields&...>;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = soa_detail::soa_iterator<SoAVector, reference>;
+    using const_iterator = soa_detail::soa_iterator<const SoAVector, const_reference>;
+
+    // 构造函数声明
+    SoAVector() noexcept;
+    SoAVector(std::initializer_list<value_type> init);
+    SoAVector(const SoAVector& other);
+    SoAVector(SoAVector&& other) noexcept;
+    // 赋值运算符声明
+    SoAVector& operator=(const SoAVector& other);
+    SoAVector& operator=(SoAVector&& other) noexcept;
+    // 析构函数声明
+    ~SoAVector();
+    // 迭代器函数声明
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    // 按行访问，返回各字段引用组成的 tuple
+    reference row(size_t index) noexcept;
+    const_reference row(size_t index) const noexcept;
+    reference operator[](size_t index);
+    const_reference operator[](size_t index) const;
+    reference at(size_t index);
+    const_reference at(size_t index) const;
+    // 按列访问：第 I 个字段的连续视图，适合向量化的扫描
+    template <size_t I>
+    std::span<field_t<I>> column() noexcept;
+    template <size_t I>
+    std::span<const field_t<I>> column() const noexcept;
+    // 容量和大小函数声明
+    [[nodiscard]] size_t size() const noexcept;
+    [[nodiscard]] size_t capacity() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+    void reserve(size_t new_capacity);
+    void resize(size_t n);
+    void clear() noexcept;
+    // 添加元素函数声明：每个字段一个参数
+    void push_back(const value_type& value);
+    void push_back(value_type&& value);
+    template <typename... Args>
+        requires (sizeof...(Args) == sizeof...(Fields))
+    void emplace_back(Args&&... args);
+    void pop_back();
+    // 删除元素函数声明，返回指向被删除元素之后元素的迭代器。
+    // 各列分别前移，要求每个字段的移动赋值不抛异常
+    iterator erase(iterator pos);
+    iterator erase(iterator first, iterator last);
+    // 排序（不稳定）：先对行号排序，再按排列一次性重排所有列
+    template <typename Compare>
+    void sort(Compare cmp);
+    // 只比较第 I 个字段的排序，比较时只读取这一列
+    template <size_t I, typename Compare = std::less<field_t<I>>>
+    void sort_by(Compare cmp = Compare());
+    void swap(SoAVector& other) noexcept;
+};
+
+// 私有辅助函数实现
+template <typename... Fields>
+size_t SoAVector<Fields...>::next_capacity() const noexcept {
+    return (soa_capacity == 0) ? 1 : 2 * soa_capacity;
+}
+
+template <typename... Fields>
+void SoAVector<Fields...>::reallocate(size_t new_capacity) {
+    reallocate_columns(new_capacity, field_indices{});
+}
+
+template <typename... Fields>
+template <size_t... I>
+void SoAVector<Fields...>::reallocate_columns(size_t new_capacity, std::index_sequence<I...>) {
+    std::tuple<Fields*...> fresh{};
+    size_t done = 0;  // 已经搬运完成的列数
+    // 按位搬运的列只是复制了字节，旧列仍然拥有这些对象，回滚时只释放内存
+    auto release = [&]<size_t J>() noexcept {
+        if (!vector_detail::relocate_bitwise<field_alloc<J>, field_t<J>> && J < done) {
+            vector_detail::destroy(allocator_for<J>(), std::get<J>(fresh), std::get<J>(fresh) + soa_size);
+        }
+        if (std::get<J>(fresh)) {
+            field_traits<J>::deallocate(allocator_for<J>(), std::get<J>(fresh), new_capacity);
+        }
+    };
+    auto transfer = [&]<size_t J>() {
+        field_t<J>* src = std::get<J>(columns);
+        // 按位搬运只复制字节，不会失败，也不改变旧列
+        if constexpr (vector_detail::relocate_bitwise<field_alloc<J>, field_t<J>> || transfer_by_move<J>) {
+            vector_detail::uninitialized_move_if_noexcept(allocator_for<J>(), src, src + soa_size, std::get<J>(fresh));
+        } else {
+            vector_detail::uninitialized_copy_n(allocator_for<J>(), src, soa_size, std::get<J>(fresh));
+        }
+        ++done;
+    };
+    try {
+        // 先分配所有列，分配失败时还没有任何元素被搬运
+        ((std::get<I>(fresh) = field_traits<I>::allocate(allocator_for<I>(), new_capacity)), ...);
+        (transfer.template operator()<I>(), ...);
+    } catch (...) {
+        (release.template operator()<I>(), ...);
+        throw;
+    }
+    // 所有列都成功后才销毁旧内容；按位搬运的列旧对象的所有权已经转移
+    ((vector_detail::relocate_bitwise<field_alloc<I>, field_t<I>>
+          ? void()
+          : vector_detail::destroy(allocator_for<I>(), std::get<I>(columns), std::get<I>(columns) + soa_size)), ...);
+    deallocate_columns(field_indices{});
+    columns = fresh;
+    soa_capacity = new_capacity;
+}
+
+template <typename... Fields>
+template <size_t... I>
+void SoAVector<Fields...>::destroy_rows(size_t first, size_t last, std::index_sequence<I...>) noexcept {
+    (vector_detail::destroy(allocator_for<I>(), std::get<I>(columns) + first, std::get<I>(columns) + last), ...);
+}
+
+template <typename... Fields>
+template <size_t... I>
+void SoAVector<Fields...>::deallocate_columns(std::index_sequence<I...>) noexcept {
+    ((std::get<I>(columns) ? field_traits<I>::deallocate(allocator_for<I>(), std::get<I>(columns), soa_capacity)
+                           : void()), ...);
+}
+
+template <typename... Fields>
+template <size_t... I, typename... Args>
+void SoAVector<Fields...>::construct_row(size_t index, std::index_sequence<I...>, Args&&... args) {
+    size_t done = 0;
+    try {
+        ((field_traits<I>::construct(allocator_for<I>(), std::get<I>(columns) + index, std::forward<Args>(args)),
+          ++done), ...);
+    } catch (...) {
+        ((I < done ? field_traits<I>::destroy(allocator_for<I>(), std::get<I>(columns) + index) : void()), ...);
+        throw;
+    }
+}
+
+template <typename... Fields>
+template <size_t... I>
+void SoAVector<Fields...>::value_construct_rows(size_t first, size_t last, std::index_sequence<I...>) {
+    size_t done = 0;
+    try {
+        ((vector_detail::uninitialized_value_construct_n(allocator_for<I>(), std::get<I>(columns) + first, last - first),
+          ++done), ...);
+    } catch (...) {
+        ((I < done ? vector_detail::destroy(allocator_for<I>(), std::get<I>(columns) + first, std::get<I>(columns) + last)
+                   : void()), ...);
+        throw;
+    }
+}
+
+template <typename... Fields>
+template <size_t... I>
+void SoAVector<Fields...>::erase_rows(size_t index, size_t n, std::index_sequence<I...>) {
+    // 逐列前移，某一列中途抛异常会让各列的行错开，因此要求前移不会失败
+    static_assert(((vector_detail::relocate_bitwise<field_alloc<I>, field_t<I>> ||
+                    std::is_nothrow_move_assignable_v<field_t<I>>) && ...),
+                  "SoAVector::erase 要求每个字段的移动赋值不抛异常");
+    (vector_detail::erase_range_in_place(allocator_for<I>(), std::get<I>(columns), soa_size, index, n), ...);
+}
+
+template <typename... Fields>
+template <size_t... I>
+void SoAVector<Fields...>::apply_permutation(const size_t* order, std::index_sequence<I...>) {
+    // 先分配所有列并构造好重排后的新内容，全部成功后再替换，异常时容器保持不变
+    std::tuple<Fields*...> fresh{};
+    size_t done = 0;  // 已经构造完成的列数
+    auto permute = [&]<size_t J>() {
+        field_t<J>* dest = std::get<J>(fresh);
+        field_t<J>* src = std::get<J>(columns);
+        size_t i = 0;
+        try {
+            for (; i < soa_size; ++i) {
+                field_traits<J>::construct(allocator_for<J>(), dest + i, transfer_source<J>(src[order[i]]));
+            }
+        } catch (...) {
+            vector_detail::destroy(allocator_for<J>(), dest, dest + i);
+            throw;
+        }
+        ++done;
+    };
+    try {
+        ((std::get<I>(fresh) = field_traits<I>::allocate(allocator_for<I>(), soa_capacity)), ...);
+        (permute.template operator()<I>(), ...);
+    } catch (...) {
+        ((I < done ? vector_detail::destroy(allocator_for<I>(), std::get<I>(fresh), std::get<I>(fresh) + soa_size)
+                   : void()), ...);
+        ((std::get<I>(fresh) ? field_traits<I>::deallocate(allocator_for<I>(), std::get<I>(fresh), soa_capacity)
+                             : void()), ...);
+        throw;
+    }
+    destroy_rows(0, soa_size, field_indices{});
+    deallocate_columns(field_indices{});
+    columns = fresh;
+}
+
+template <typename... Fields>
+template <size_t... I>
+auto SoAVector<Fields...>::make_row(size_t index, std::index_sequence<I...>) noexcept {
+    return reference(std::get<I>(columns)[index]...);
+}
+
+template <typename... Fields>
+template <size_t... I>
+auto SoAVector<Fields...>::make_row(size_t index, std::index_sequence<I...>) const noexcept {
+    return const_reference(std::get<I>(columns)[index]...);
+}
+
+// 构造函数实现
+template <typename... Fields>
+SoAVector<Fields...>::SoAVector() noexcept : columns{}, soa_size(0), soa_capacity(0), allocators{} {}
+
+template <typename... Fields>
+SoAVector<Fields...>::SoAVector(std::initializer_list<value_type> init) : SoAVector() {
+    reserve(init.size());
+    for (const value_type& value : init) {
+        push_back(value);
+    }
+}
+
+template <typename... Fields>
+SoAVector<Fields...>::SoAVector(const SoAVector& other) : SoAVector() {
+    reserve(other.soa_size);
+    for (size_t i = 0; i < other.soa_size; ++i) {
+        std::apply([&](const Fields&... fields) { emplace_back(fields...); }, other.row(i));
+    }
+}
+
+template <typename... Fields>
+SoAVector<Fields...>::SoAVector(SoAVector&& other) noexcept
+    : columns(other.columns), soa_size(other.soa_size), soa_capacity(other.soa_capacity), allocators{} {
+    other.columns = {};
+    other.soa_size = 0;
+    other.soa_capacity = 0;
+}
+
+// 赋值运算符实现
+template <typename... Fields>
+SoAVector<Fields...>& SoAVector<Fields...>::operator=(const SoAVector& other) {
+    if (this != &other) {
+        SoAVector copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+template <typename... Fields>
+SoAVector<Fields...>& SoAVector<Fields...>::operator=(SoAVector&& other) noexcept {
+    if (this != &other) {
+        clear();
+        deallocate_columns(field_indices{});
+        columns = other.columns;
+        soa_size = other.soa_size;
+        soa_capacity = other.soa_capacity;
+        other.columns = {};
+        other.soa_size = 0;
+        other.soa_capacity = 0;
+    }
+    return *this;
+}
+
+// 析构函数实现
+template <typename... Fields>
+SoAVector<Fields...>::~SoAVector() {
+    clear();
+    deallocate_columns(field_indices{});
+}
+
+// 迭代器函数实现
+template <typename... Fields>
+typename SoAVector<Fields...>::iterator SoAVector<Fields...>::begin() noexcept {
+    return iterator(this, 0);
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::const_iterator SoAVector<Fields...>::begin() const noexcept {
+    return const_iterator(this, 0);
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::iterator SoAVector<Fields...>::end() noexcept {
+    return iterator(this, soa_size);
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::const_iterator SoAVector<Fields...>::end() const noexcept {
+    return const_iterator(this, soa_size);
+}
+
+// 访问元素函数实现
+template <typename... Fields>
+typename SoAVector<Fields...>::reference SoAVector<Fields...>::row(size_t index) noexcept {
+    return make_row(index, field_indices{});
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::const_reference SoAVector<Fields...>::row(size_t index) const noexcept {
+    return make_row(index, field_indices{});
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::reference SoAVector<Fields...>::operator[](size_t index) {
+#ifndef MYSTL_VECTOR_UNCHECKED
+    if (index >= soa_size) {
+        throw std::out_of_range("SoAVector::operator[]");
+    }
+#endif
+    return row(index);
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::const_reference SoAVector<Fields...>::operator[](size_t index) const {
+#ifndef MYSTL_VECTOR_UNCHECKED
+    if (index >= soa_size) {
+        throw std::out_of_range("SoAVector::operator[]");
+    }
+#endif
+    return row(index);
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::reference SoAVector<Fields...>::at(size_t index) {
+    if (index >= soa_size) {
+        throw std::out_of_range("SoAVector::at");
+    }
+    return row(index);
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::const_reference SoAVector<Fields...>::at(size_t index) const {
+    if (index >= soa_size) {
+        throw std::out_of_range("SoAVector::at");
+    }
+    return row(index);
+}
+
+template <typename... Fields>
+template <size_t I>
+std::span<typename SoAVector<Fields...>::template field_t<I>> SoAVector<Fields...>::column() noexcept {
+    return std::span<field_t<I>>(std::get<I>(columns), soa_size);
+}
+
+template <typename... Fields>
+template <size_t I>
+std::span<const typename SoAVector<Fields...>::template field_t<I>> SoAVector<Fields...>::column() const noexcept {
+    return std::span<const field_t<I>>(std::get<I>(columns), soa_size);
+}
+
+// 容量和大小函数实现
+template <typename... Fields>
+size_t SoAVector<Fields...>::size() const noexcept {
+    return soa_size;
+}
+
+template <typename... Fields>
+size_t SoAVector<Fields...>::capacity() const noexcept {
+    return soa_capacity;
+}
+
+template <typename... Fields>
+bool SoAVector<Fields...>::empty() const noexcept {
+    return soa_size == 0;
+}
+
+template <typename... Fields>
+void SoAVector<Fields...>::reserve(size_t new_capacity) {
+    if (new_capacity <= soa_capacity) return;
+    reallocate(new_capacity);
+}
+
+template <typename... Fields>
+void SoAVector<Fields...>::resize(size_t n) {
+    if (n <= soa_size) {
+        destroy_rows(n, soa_size, field_indices{});
+    } else {
+        if (n > soa_capacity) {
+            reserve(std::max(n, next_capacity()));
+        }
+        value_construct_rows(soa_size, n, field_indices{});
+    }
+    soa_size = n;
+}
+
+// 清空函数实现：保留容量
+template <typename... Fields>
+void SoAVector<Fields...>::clear() noexcept {
+    destroy_rows(0, soa_size, field_indices{});
+    soa_size = 0;
+}
+
+// 添加元素函数实现
+template <typename... Fields>
+void SoAVector<Fields...>::push_back(const value_type& value) {
+    std::apply([&](const Fields&... fields) { emplace_back(fields...); }, value);
+}
+
+template <typename... Fields>
+void SoAVector<Fields...>::push_back(value_type&& value) {
+    std::apply([&](Fields&... fields) { emplace_back(std::move(fields)...); }, value);
+}
+
+template <typename... Fields>
+template <typename... Args>
+    requires (sizeof...(Args) == sizeof...(Fields))
+void SoAVector<Fields...>::emplace_back(Args&&... args) {
+    if (soa_size == soa_capacity) {
+        // 参数可能引用本容器的元素，扩容前先构造成临时行
+        value_type tmp(std::forward<Args>(args)...);
+        reserve(next_capacity());
+        std::apply([&](Fields&... fields) { construct_row(soa_size, field_indices{}, std::move(fields)...); }, tmp);
+    } else {
+        construct_row(soa_size, field_indices{}, std::forward<Args>(args)...);
+    }
+    ++soa_size;
+}
+
+template <typename... Fields>
+void SoAVector<Fields...>::pop_back() {
+    if (soa_size == 0) {
+        throw std::out_of_range("SoAVector::pop_back");
+    }
+    destroy_rows(soa_size - 1, soa_size, field_indices{});
+    --soa_size;
+}
+
+// 删除元素函数实现
+template <typename... Fields>
+typename SoAVector<Fields...>::iterator SoAVector<Fields...>::erase(iterator pos) {
+    return erase(pos, pos + 1);
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::iterator SoAVector<Fields...>::erase(iterator first, iterator last) {
+    size_t index = first.position();
+    size_t n = last.position() - index;
+    erase_rows(index, n, field_indices{});
+    soa_size -= n;
+    return iterator(this, index);
+}
+
+// 排序函数实现
+template <typename... Fields>
+template <typename Compare>
+void SoAVector<Fields...>::sort(Compare cmp) {
+    if (soa_size < 2) return;
+    Vector<size_t> order;
+    order.resize_for_overwrite(soa_size);
+    std::iota(order.data(), order.data() + soa_size, size_t(0));
+    const SoAVector& self = *this;
+    sort_detail::pdqsort(order.data(), order.data() + soa_size,
+                         [&](size_t a, size_t b) { return cmp(self.row(a), self.row(b)); });
+    apply_permutation(order.data(), field_indices{});
+}
+
+template <typename... Fields>
+template <size_t I, typename Compare>
+void SoAVector<Fields...>::sort_by(Compare cmp) {
+    if (soa_size < 2) return;
+    Vector<size_t> order;
+    order.resize_for_overwrite(soa_size);
+    std::iota(order.data(), order.data() + soa_size, size_t(0));
+    const field_t<I>* keys = std::get<I>(columns);
+    sort_detail::pdqsort(order.data(), order.data() + soa_size,
+                         [&](size_t a, size_t b) { return cmp(keys[a], keys[b]); });
+    apply_permutation(order.data(), field_indices{});
+}
+
+// 交换函数实现
+template <typename... Fields>
+void SoAVector<Fields...>::swap(SoAVector& other) noexcept {
+    std::swap(columns, other.columns);
+    std::swap(soa_size, other.soa_size);
+    std::swap(soa_capacity, other.soa_capacity);
+}
+
+#endif // SOA_VECTOR_H
@@ -0,0 +1,459 @@
+#ifndef SORT_H
+#define SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// 连续内存上的排序引擎，Vector/SmallVector 的 sort/stable_sort 都转发到这里。
+// sort 采用 pattern-defeating quicksort（pdqsort）：
+//   - 小区间（< 24）直接插入排序
+//   - 中等区间三数取中，大区间（> 128）用 ninther 选基准
+//   - 与左侧基准相等的区间一次性划出，大量重复元素时退化为线性
+//   - 划分严重失衡时打乱样本，失衡次数超过 log2(n) 后改用堆排序，保证 O(n log n)
+//   - 算术类型配合默认比较器时使用无分支的块划分（BlockQuicksort）
+//   - 只对较小的一侧递归，栈深度不超过 O(log n)
+// stable_sort 为带缓冲区的归并排序，小区间用插入排序。
+namespace sort_detail {
+
+constexpr std::ptrdiff_t insertion_sort_threshold = 24;
+constexpr std::ptrdiff_t ninther_threshold = 128;
+constexpr size_t partial_insertion_sort_limit = 8;
+constexpr size_t block_size = 64;
+constexpr size_t cacheline_size = 64;
+constexpr std::ptrdiff_t stable_insertion_threshold = 32;
+
+// 默认比较器 + 算术类型时比较结果可以无分支地使用
+template <typename T, typename Compare>
+inline constexpr bool use_branchless_partition =
+    std::is_arithmetic_v<T> &&
+    (std::is_same_v<Compare, std::less<T>> || std::is_same_v<Compare, std::less<>> ||
+     std::is_same_v<Compare, std::greater<T>> || std::is_same_v<Compare, std::greater<>>);
+
+template <typename T, typename Compare>
+void insertion_sort(T* begin, T* end, Compare& comp) {
+    if (begin == end) return;
+    for (T* cur = begin + 1; cur != end; ++cur) {
+        T* sift = cur;
+        T* sift_1 = cur - 1;
+        if (comp(*sift, *sift_1)) {
+            T tmp = std::move(*sift);
+            do {
+                *sift-- = std::move(*sift_1);
+            } while (sift != begin && comp(tmp, *--sift_1));
+            *sift = std::move(tmp);
+        }
+    }
+}
+
+// 要求 *(begin - 1) 不大于区间内任何元素，可以省掉边界检查
+template <typename T, typename Compare>
+void unguarded_insertion_sort(T* begin, T* end, Compare& comp) {
+    if (begin == end) return;
+    for (T* cur = begin + 1; cur != end; ++cur) {
+        T* sift = cur;
+        T* sift_1 = cur - 1;
+        if (comp(*sift, *sift_1)) {
+            T tmp = std::move(*sift);
+            do {
+                *sift-- = std::move(*sift_1);
+            } while (comp(tmp, *--sift_1));
+            *sift = std::move(tmp);
+        }
+    }
+}
+
+// 尝试插入排序，移动次数超过限制就放弃并返回 false，用于识别近似有序的区间
+template <typename T, typename Compare>
+bool partial_insertion_sort(T* begin, T* end, Compare& comp) {
+    if (begin == end) return true;
+    size_t limit = 0;
+    for (T* cur = begin + 1; cur != end; ++cur) {
+        T* sift = cur;
+        T* sift_1 = cur - 1;
+        if (comp(*sift, *sift_1)) {
+            T tmp = std::move(*sift);
+            do {
+                *sift-- = std::move(*sift_1);
+            } while (sift != begin && comp(tmp, *--sift_1));
+            *sift = std::move(tmp);
+            limit += cur - sift;
+        }
+        if (limit > partial_insertion_sort_limit) return false;
+    }
+    return true;
+}
+
+template <typename T, typename Compare>
+void sort2(T* a, T* b, Compare& comp) {
+    if (comp(*b, *a)) std::iter_swap(a, b);
+}
+
+template <typename T, typename Compare>
+void sort3(T* a, T* b, T* c, Compare& comp) {
+    sort2(a, b, comp);
+    sort2(b, c, comp);
+    sort2(a, b, comp);
+}
+
+template <typename T, typename Compare>
+void heap_sort(T* begin, T* end, Compare& comp) {
+    std::make_heap(begin, end, comp);
+    std::sort_heap(begin, end, comp);
+}
+
+inline unsigned char* align_cacheline(unsigned char* p) {
+    auto ip = reinterpret_cast<std::uintptr_t>(p);
+    ip = (ip + cacheline_size - 1) & ~static_cast<std::uintptr_t>(cacheline_size - 1);
+    return reinterpret_cast<unsigned char*>(ip);
+}
+
+template <typename T>
+void swap_offsets(T* first, T* last, const unsigned char* offsets_l, const unsigned char* offsets_r,
+                  size_t num, bool use_swaps) {
+    if (use_swaps) {
+        // 两侧数量相同时必须两两交换，否则轮换会把元素放错位置
+        for (size_t i = 0; i < num; ++i) {
+            std::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+        }
+    } else if (num > 0) {
+        T* l = first + offsets_l[0];
+        T* r = last - offsets_r[0];
+        T tmp(std::move(*l));
+        *l = std::move(*r);
+        for (size_t i = 1; i < num; ++i) {
+            l = first + offsets_l[i];
+            *r = std::move(*l);
+            r = last - offsets_r[i];
+            *l = std::move(*r);
+        }
+        *r = std::move(tmp);
+    }
+}
+
+// 以 *begin 为基准划分，等于基准的元素放在右侧。
+// 返回基准的最终位置，以及划分前区间是否已经有序划分好
+template <typename T, typename Compare>
+std::pair<T*, bool> partition_right(T* begin, T* end, Compare& comp) {
+    T pivot(std::move(*begin));
+    T* first = begin;
+    T* last = end;
+
+    // 找到第一个不小于基准的元素；基准是三数中值，右侧必然存在哨兵
+    while (comp(*++first, pivot));
+    if (first - 1 == begin) {
+        while (first < last && !comp(*--last, pivot));
+    } else {
+        while (!comp(*--last, pivot));
+    }
+
+    bool already_partitioned = first >= last;
+    while (first < last) {
+        std::iter_swap(first, last);
+        while (comp(*++first, pivot));
+        while (!comp(*--last, pivot));
+    }
+
+    T* pivot_pos = first - 1;
+    *begin = std::move(*pivot_pos);
+    *pivot_pos = std::move(pivot);
+    return {pivot_pos, already_partitioned};
+}
+
+// 与 partition_right 相同，但先收集需要交换的元素偏移，再批量交换，
+// 比较结果直接累加到下标上，内层循环没有依赖数据的分支
+template <typename T, typename Compare>
+std::pair<T*, bool> partition_right_branchless(T* begin, T* end, Compare& comp) {
+    T pivot(std::move(*begin));
+    T* first = begin;
+    T* last = end;
+
+    while (comp(*++first, pivot));
+    if (first - 1 == begin) {
+        while (first < last && !comp(*--last, pivot));
+    } else {
+        while (!comp(*--last, pivot));
+    }
+
+    bool already_partitioned = first >= last;
+    if (!already_partitioned) {
+        std::iter_swap(first, last);
+        ++first;
+
+        unsigned char offsets_l_storage[block_size + cacheline_size];
+        unsigned char offsets_r_storage[block_size + cacheline_size];
+        unsigned char* offsets_l = align_cacheline(offsets_l_storage);
+        unsigned char* offsets_r = align_cacheline(offsets_r_storage);
+
+        T* offsets_l_base = first;
+        T* offsets_r_base = last;
+        size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+        while (first < last) {
+            // 剩余元素不足两个块时按比例分给两侧
+            size_t num_unknown = last - first;
+            size_t left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+            size_t right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+
+            if (left_split >= block_size) {
+                for (size_t i = 0; i < block_size;) {
+                    offsets_l[num_l] = static_cast<unsigned char>(i++); num_l += !comp(*first, pivot); ++first;
+                    offsets_l[num_l] = static_cast<unsigned char>(i++); num_l += !comp(*first, pivot); ++first;
+                    offsets_l[num_l] = static_cast<unsigned char>(i++); num_l += !comp(*first, pivot); ++first;
+                    offsets_l[num_l] = static_cast<unsigned char>(i++); num_l += !comp(*first, pivot); ++first;
+                }
+            } else {
+                for (size_t i = 0; i < left_split;) {
+                    offsets_l[num_l] = static_cast<unsigned char>(i++); num_l += !comp(*first, pivot); ++first;
+                }
+            }
+
+            if (right_split >= block_size) {
+                for (size_t i = 0; i < block_size;) {
+                    offsets_r[num_r] = static_cast<unsigned char>(++i); num_r += comp(*--last, pivot);
+                    offsets_r[num_r] = static_cast<unsigned char>(++i); num_r += comp(*--last, pivot);
+                    offsets_r[num_r] = static_cast<unsigned char>(++i); num_r += comp(*--last, pivot);
+                    offsets_r[num_r] = static_cast<unsigned char>(++i); num_r += comp(*--last, pivot);
+                }
+            } else {
+                for (size_t i = 0; i < right_split;) {
+                    offsets_r[num_r] = static_cast<unsigned char>(++i); num_r += comp(*--last, pivot);
+                }
+            }
+
+            size_t num = std::min(num_l, num_r);
+            swap_offsets(offsets_l_base, offsets_r_base, offsets_l + start_l, offsets_r + start_r,
+                         num, num_l == num_r);
+            num_l -= num;
+            num_r -= num;
+            start_l += num;
+            start_r += num;
+            if (num_l == 0) {
+                start_l = 0;
+                offsets_l_base = first;
+            }
+            if (num_r == 0) {
+                start_r = 0;
+                offsets_r_base = last;
+            }
+        }
+
+        // 只有一侧还有未放好的元素，把它们换到中间
+        if (num_l) {
+            offsets_l += start_l;
+            while (num_l--) std::iter_swap(offsets_l_base + offsets_l[num_l], --last);
+            first = last;
+        }
+        if (num_r) {
+            offsets_r += start_r;
+            while (num_r--) {
+                std::iter_swap(offsets_r_base - offsets_r[num_r], first);
+                ++first;
+            }
+            last = first;
+        }
+    }
+
+    T* pivot_pos = first - 1;
+    *begin = std::move(*pivot_pos);
+    *pivot_pos = std::move(pivot);
+    return {pivot_pos, already_partitioned};
+}
+
+// 以 *begin 为基准划分，等于基准的元素放在左侧。用于基准与左侧已排好区间的
+// 最大值相等的情况：此时左侧整段都等于基准，之后无需再处理
+template <typename T, typename Compare>
+T* partition_left(T* begin, T* end, Compare& comp) {
+    T pivot(std::move(*begin));
+    T* first = begin;
+    T* last = end;
+
+    while (comp(pivot, *--last));
+    if (last + 1 == end) {
+        while (first < last && !comp(pivot, *++first));
+    } else {
+        while (!comp(pivot, *++first));
+    }
+
+    while (first < last) {
+        std::iter_swap(first, last);
+        while (comp(pivot, *--last));
+        while (!comp(pivot, *++first));
+    }
+
+    T* pivot_pos = last;
+    *begin = std::move(*pivot_pos);
+    *pivot_pos = std::move(pivot);
+    return pivot_pos;
+}
+
+// 失衡划分后打乱部分元素，破坏导致失衡的输入模式
+template <typename T>
+void break_patterns(T* begin, T* pivot_pos, T* end) {
+    std::ptrdiff_t l_size = pivot_pos - begin;
+    std::ptrdiff_t r_size = end - (pivot_pos + 1);
+    if (l_size >= insertion_sort_threshold) {
+        std::iter_swap(begin, begin + l_size / 4);
+        std::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+        if (l_size > ninther_threshold) {
+            std::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+            std::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+            std::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+            std::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+        }
+    }
+    if (r_size >= insertion_sort_threshold) {
+        std::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+        std::iter_swap(end - 1, end - r_size / 4);
+        if (r_size > ninther_threshold) {
+            std::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+            std::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+            std::iter_swap(end - 2, end - (1 + r_size / 4));
+            std::iter_swap(end - 3, end - (2 + r_size / 4));
+        }
+    }
+}
+
+// leftmost 为 false 时 *(begin - 1) 是左侧已排好区间的最大值，可作为哨兵
+template <bool Branchless, typename T, typename Compare>
+void pdqsort_loop(T* begin, T* end, Compare& comp, int bad_allowed, bool leftmost) {
+    while (true) {
+        std::ptrdiff_t size = end - begin;
+        if (size < insertion_sort_threshold) {
+            if (leftmost) {
+                insertion_sort(begin, end, comp);
+            } else {
+                unguarded_insertion_sort(begin, end, comp);
+            }
+            return;
+        }
+
+        // 选择基准并放到 begin
+        std::ptrdiff_t s2 = size / 2;
+        if (size > ninther_threshold) {
+            sort3(begin, begin + s2, end - 1, comp);
+            sort3(begin + 1, begin + (s2 - 1), end - 2, comp);
+            sort3(begin + 2, begin + (s2 + 1), end - 3, comp);
+            sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), comp);
+            std::iter_swap(begin, begin + s2);
+        } else {
+            sort3(begin + s2, begin, end - 1, comp);
+        }
+
+        // 基准等于左侧最大值：区间内没有比它更小的元素，把等于基准的一段划走
+        if (!leftmost && !comp(*(begin - 1), *begin)) {
+            begin = partition_left(begin, end, comp) + 1;
+            continue;
+        }
+
+        auto [pivot_pos, already_partitioned] = Branchless
+            ? partition_right_branchless(begin, end, comp)
+            : partition_right(begin, end, comp);
+
+        std::ptrdiff_t l_size = pivot_pos - begin;
+        std::ptrdiff_t r_size = end - (pivot_pos + 1);
+        bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+        if (highly_unbalanced) {
+            // 失衡次数过多，改用堆排序保证最坏复杂度
+            if (--bad_allowed == 0) {
+                heap_sort(begin, end, comp);
+                return;
+            }
+            break_patterns(begin, pivot_pos, end);
+        } else if (already_partitioned &&
+                   partial_insertion_sort(begin, pivot_pos, comp) &&
+                   partial_insertion_sort(pivot_pos + 1, end, comp)) {
+            // 输入本来就基本有序
+            return;
+        }
+
+        // 递归处理较小的一侧，较大的一侧继续循环，栈深度为 O(log n)
+        if (l_size < r_size) {
+            pdqsort_loop<Branchless>(begin, pivot_pos, comp, bad_allowed, leftmost);
+            begin = pivot_pos + 1;
+            leftmost = false;
+        } else {
+            pdqsort_loop<Branchless>(pivot_pos + 1, end, comp, bad_allowed, false);
+            end = pivot_pos;
+        }
+    }
+}
+
+template <typename T, typename Compare>
+void pdqsort(T* begin, T* end, Compare comp) {
+    if (end - begin < 2) return;
+    int bad_allowed = 1;
+    for (size_t n = end - begin; n > 1; n >>= 1) {
+        ++bad_allowed;
+    }
+    pdqsort_loop<use_branchless_partition<T, Compare>>(begin, end, comp, bad_allowed, true);
+}
+
+// 归并 buffer 中的左半部分与 [mid, last)，结果写回 first。
+// 比较器抛异常时把 buffer 中剩余元素移回原区间，保证不丢元素
+template <typename T, typename Compare>
+void merge_from_buffer(T* buffer, T* buffer_end, T* mid, T* last, T* out, Compare& comp) {
+    T* a = buffer;
+    T* b = mid;
+    try {
+        while (a != buffer_end && b != last) {
+            if (comp(*b, *a)) {
+                *out++ = std::move(*b++);
+            } else {
+                *out++ = std::move(*a++);
+            }
+        }
+    } catch (...) {
+        std::move(a, buffer_end, out);
+        std::destroy(buffer, buffer_end);
+        throw;
+    }
+    std::move(a, buffer_end, out);
+    std::destroy(buffer, buffer_end);
+}
+
+template <typename T, typename Compare>
+void merge_sort(T* first, T* last, T* buffer, Compare& comp) {
+    std::ptrdiff_t n = last - first;
+    if (n <= stable_insertion_threshold) {
+        insertion_sort(first, last, comp);
+        return;
+    }
+    T* mid = first + n / 2;
+    merge_sort(first, mid, buffer, comp);
+    merge_sort(mid, last, buffer, comp);
+    // 两半已经首尾有序，不需要归并
+    if (!comp(*mid, *(mid - 1))) return;
+    T* buffer_end = std::uninitialized_move(first, mid, buffer);
+    merge_from_buffer(buffer, buffer_end, mid, last, first, comp);
+}
+
+template <typename T, typename Compare>
+void stable_sort(T* first, T* last, Compare comp) {
+    std::ptrdiff_t n = last - first;
+    if (n <= stable_insertion_threshold) {
+        insertion_sort(first, last, comp);
+        return;
+    }
+    // 归并时只需要暂存左半部分
+    std::allocator<T> alloc;
+    size_t buffer_size = static_cast<size_t>(n / 2);
+    T* buffer = alloc.allocate(buffer_size);
+    try {
+        merge_sort(first, last, buffer, comp);
+    } catch (...) {
+        alloc.deallocate(buffer, buffer_size);
+        throw;
+    }
+    alloc.deallocate(buffer, buffer_size);
+}
+
+} // namespace sort_detail
+
+#endif // SORT_H
@@ -6,68 +6,498 @@
 #include <initializer_list>
 #include <algorithm>
 #include <iostream>
+#include <type_traits>
+#include <cstring>
+#include <cstddef>
+#include <iterator>
+#include <concepts>
+#include <compare>
+#include <span>
+#include <ranges>
+#include "sort.hpp"
+#include "radix_sort.hpp"
+#include "function_ref.hpp"
+#include "simd_search.hpp"
+#include "vector_telemetry.hpp"
+
+// 可平凡重定位萃取：这类类型"移动构造到新地址 + 销毁旧对象"等价于按位复制，
+// 默认与可平凡复制一致；只持有句柄/指针的用户类型可以特化为 std::true_type 显式开启
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+namespace vector_detail {
+
+// 分配器自定义了 construct/destroy 时，元素的构造和销毁必须经过分配器，不能按位搬运
+template <typename Alloc, typename T>
+concept allocator_customizes_construct =
+    requires(Alloc& alloc, T* p) { alloc.construct(p, std::move(*p)); } ||
+    requires(Alloc& alloc, T* p) { alloc.destroy(p); };
+
+template <typename Alloc, typename T>
+inline constexpr bool relocate_bitwise =
+    is_trivially_relocatable_v<T> && !allocator_customizes_construct<Alloc, T>;
+
+// 分配器提供 reallocate(p, old_n, new_n) 时（如 MmapAllocator），可按位重定位的元素
+// 扩容和缩容交给分配器原地完成，不再经过"申请新内存 + 搬运"
+template <typename Alloc, typename T>
+concept allocator_reallocates = requires(Alloc& alloc, T* p, size_t n) {
+    { alloc.reallocate(p, n, n) } -> std::same_as<T*>;
+};
+
+template <typename Alloc, typename T>
+inline constexpr bool reallocate_in_place = relocate_bitwise<Alloc, T> && allocator_reallocates<Alloc, T>;
+
+// 分配器提供 discard(p, capacity, used) 时，元素个数大幅减少后把多余的物理页交还系统
+template <typename Alloc, typename T>
+concept allocator_discards = requires(Alloc& alloc, T* p, size_t n) { alloc.discard(p, n, n); };
+
+// 销毁 [first, last) 中的元素
+template <typename Alloc, typename T>
+void destroy(Alloc& alloc, T* first, T* last) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T> || allocator_customizes_construct<Alloc, T>) {
+        for (; first != last; ++first) {
+            std::allocator_traits<Alloc>::destroy(alloc, first);
+        }
+    }
+}
+
+// 把 [first, last) 移动（移动构造可能抛异常时退化为拷贝）到未初始化内存 dest，
+// 源保持不变；中途抛异常时销毁已构造的部分再重新抛出
+template <typename Alloc, typename T>
+T* uninitialized_move_if_noexcept(Alloc& alloc, T* first, T* last, T* dest) {
+    if constexpr (relocate_bitwise<Alloc, T>) {
+        if (first != last) {
+            std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), (last - first) * sizeof(T));
+        }
+        vector_telemetry::record_moved<T>(last - first);
+        return dest + (last - first);
+    } else {
+        T* cur = dest;
+        try {
+            for (; first != last; ++first, ++cur) {
+                std::allocator_traits<Alloc>::construct(alloc, cur, std::move_if_noexcept(*first));
+            }
+        } catch (...) {
+            destroy(alloc, dest, cur);
+            throw;
+        }
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            vector_telemetry::record_moved<T>(cur - dest);
+        } else {
+            vector_telemetry::record_copied<T>(cur - dest);
+        }
+        return cur;
+    }
+}
+
+// 把 [first, last) 重定位到不重叠的未初始化内存 dest，成功后源区间不再持有对象。
+// 提供强异常保证：失败时源区间原样保留
+template <typename Alloc, typename T>
+T* uninitialized_relocate(Alloc& alloc, T* first, T* last, T* dest) {
+    T* result = uninitialized_move_if_noexcept(alloc, first, last, dest);
+    if constexpr (!relocate_bitwise<Alloc, T>) {
+        destroy(alloc, first, last);
+    }
+    return result;
+}
+
+// 可以用 *it / ++it / != 遍历的类型，用于区分迭代器区间与 (n, value) 重载
+template <typename It>
+concept iterator_like = !std::is_integral_v<It> && requires(It it) { *it; ++it; it != it; };
+
+// 可以多次遍历、能预先求出长度的迭代器
+template <typename It>
+concept multipass_iterator = iterator_like<It> && std::forward_iterator<It>;
+
+// 把同一个值重复 n 次的前向迭代器，让 insert(pos, n, value) 复用区间插入的实现
+template <typename T>
+class repeat_iterator {
+    const T* value;
+    size_t index;
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    repeat_iterator() noexcept : value(nullptr), index(0) {}
+    repeat_iterator(const T* value, size_t index) noexcept : value(value), index(index) {}
+    const T& operator*() const noexcept { return *value; }
+    repeat_iterator& operator++() noexcept { ++index; return *this; }
+    repeat_iterator operator++(int) noexcept { repeat_iterator tmp = *this; ++index; return tmp; }
+    bool operator==(const repeat_iterator& other) const noexcept { return index == other.index; }
+};
+
+// 用 first 开始的 n 个元素在未初始化内存 dest 上拷贝构造，失败时回滚
+template <typename Alloc, typename T, typename InputIt>
+InputIt uninitialized_copy_n(Alloc& alloc, InputIt first, size_t n, T* dest) {
+    T* cur = dest;
+    try {
+        for (; n > 0; --n, ++first, ++cur) {
+            std::allocator_traits<Alloc>::construct(alloc, cur, *first);
+        }
+    } catch (...) {
+        destroy(alloc, dest, cur);
+        throw;
+    }
+    vector_telemetry::record_copied<T>(cur - dest);
+    return first;
+}
+
+// 在未初始化内存上值初始化 n 个元素，失败时回滚
+template <typename Alloc, typename T>
+void uninitialized_value_construct_n(Alloc& alloc, T* dest, size_t n) {
+    T* cur = dest;
+    try {
+        for (; n > 0; --n, ++cur) {
+            std::allocator_traits<Alloc>::construct(alloc, cur);
+        }
+    } catch (...) {
+        destroy(alloc, dest, cur);
+        throw;
+    }
+}
+
+// 默认初始化 n 个元素：平凡类型不写内存，供 resize_for_overwrite 使用。
+// 分配器自定义了 construct 时仍然经过分配器
+template <typename Alloc, typename T>
+void uninitialized_default_construct_n(Alloc& alloc, T* dest, size_t n) {
+    if constexpr (allocator_customizes_construct<Alloc, T>) {
+        uninitialized_value_construct_n(alloc, dest, n);
+    } else {
+        std::uninitialized_default_construct_n(dest, n);
+    }
+}
+
+// 扩容：把 [old_data, old_data + size) 搬进新内存 new_data，并在 index 处留出 gap 个位置，
+// 由 fill(new_data + index) 构造（fill 自己负责失败时的回滚）。先构造新元素，
+// 新元素的来源引用旧元素时也安全；抛异常时旧内容不变，new_data 中不留下任何对象
+template <typename Alloc, typename T, typename Fill>
+void relocate_with_gap(Alloc& alloc, T* old_data, size_t size, size_t index, T* new_data, size_t gap, Fill&& fill) {
+    int stage = 0;  // 记录已完成的步骤，异常时只回滚已构造的部分
+    try {
+        fill(new_data + index);
+        stage = 1;
+        uninitialized_move_if_noexcept(alloc, old_data, old_data + index, new_data);
+        stage = 2;
+        uninitialized_move_if_noexcept(alloc, old_data + index, old_data + size, new_data + index + gap);
+    } catch (...) {
+        if (stage >= 2) {
+            destroy(alloc, new_data, new_data + index);
+        }
+        if (stage >= 1) {
+            destroy(alloc, new_data + index, new_data + index + gap);
+        }
+        throw;
+    }
+    // 按位搬运后旧对象的所有权已经转移，不能再析构
+    if constexpr (!relocate_bitwise<Alloc, T>) {
+        destroy(alloc, old_data, old_data + size);
+    }
+}
+
+// 扩容插入单个元素
+template <typename Alloc, typename T, typename... Args>
+void relocate_with_insert(Alloc& alloc, T* old_data, size_t size, size_t index, T* new_data, Args&&... args) {
+    relocate_with_gap(alloc, old_data, size, index, new_data, 1, [&](T* dest) {
+        std::allocator_traits<Alloc>::construct(alloc, dest, std::forward<Args>(args)...);
+    });
+}
+
+// 在容量充足的缓冲区中把 tmp 移动插入到 index（index < size），调用方负责更新元素个数。
+// tmp 是调用方事先构造好的临时对象，因此插入的值引用本容器元素时也安全
+template <typename Alloc, typename T>
+void insert_in_place(Alloc& alloc, T* data, size_t size, size_t index, T& tmp) {
+    vector_telemetry::record_moved<T>(size - index);
+    if constexpr (relocate_bitwise<Alloc, T>) {
+        // 整体后移一格，空出的位置是未初始化内存
+        std::memmove(static_cast<void*>(data + index + 1), static_cast<const void*>(data + index),
+                     (size - index) * sizeof(T));
+        try {
+            std::allocator_traits<Alloc>::construct(alloc, data + index, std::move(tmp));
+        } catch (...) {
+            std::memmove(static_cast<void*>(data + index), static_cast<const void*>(data + index + 1),
+                         (size - index) * sizeof(T));
+            throw;
+        }
+    } else {
+        // 末尾元素移动构造到未初始化的新位置，其余元素移动赋值后移
+        std::allocator_traits<Alloc>::construct(alloc, data + size, std::move(data[size - 1]));
+        try {
+            std::move_backward(data + index, data + size - 1, data + size);
+            data[index] = std::move(tmp);
+        } catch (...) {
+            std::allocator_traits<Alloc>::destroy(alloc, data + size);
+            throw;
+        }
+    }
+}
+
+// 在容量充足的缓冲区中把 first 开始的 n 个元素插入到 index，调用方负责更新元素个数。
+// 只做一次整体后移；first 不能指向本缓冲区
+template <typename Alloc, typename T, typename ForwardIt>
+void insert_range_in_place(Alloc& alloc, T* data, size_t size, size_t index, ForwardIt first, size_t n) {
+    T* pos = data + index;
+    T* old_end = data + size;
+    size_t elems_after = size - index;
+    if constexpr (relocate_bitwise<Alloc, T>) {
+        vector_telemetry::record_moved<T>(elems_after);
+        std::memmove(static_cast<void*>(pos + n), static_cast<const void*>(pos), elems_after * sizeof(T));
+        try {
+            uninitialized_copy_n(alloc, first, n, pos);
+        } catch (...) {
+            std::memmove(static_cast<void*>(pos), static_cast<const void*>(pos + n), elems_after * sizeof(T));
+            throw;
+        }
+    } else if (elems_after > n) {
+        // 末尾 n 个元素移动到未初始化区域，其余后移，再把新值赋到空出的位置
+        uninitialized_move_if_noexcept(alloc, old_end - n, old_end, old_end);
+        try {
+            std::move_backward(pos, old_end - n, old_end);
+            for (size_t i = 0; i < n; ++i, ++first) {
+                pos[i] = *first;
+            }
+        } catch (...) {
+            destroy(alloc, old_end, old_end + n);
+            throw;
+        }
+        vector_telemetry::record_moved<T>(elems_after - n);
+        vector_telemetry::record_copied<T>(n);
+    } else {
+        // 超出原末尾的新值直接构造，原有的尾部整体移动到它们之后，剩余新值赋值
+        ForwardIt mid = first;
+        std::advance(mid, elems_after);
+        uninitialized_copy_n(alloc, mid, n - elems_after, old_end);
+        try {
+            uninitialized_move_if_noexcept(alloc, pos, old_end, pos + n);
+        } catch (...) {
+            destroy(alloc, old_end, old_end + (n - elems_after));
+            throw;
+        }
+        try {
+            std::copy(first, mid, pos);
+        } catch (...) {
+            destroy(alloc, old_end, old_end + n);
+            throw;
+        }
+        vector_telemetry::record_copied<T>(elems_after);
+    }
+}
+
+// 删除 [index, index + n) 并把后续元素前移，调用方负责更新元素个数
+template <typename Alloc, typename T>
+void erase_range_in_place(Alloc& alloc, T* data, size_t size, size_t index, size_t n) {
+    if (n == 0) return;
+    vector_telemetry::record_moved<T>(size - index - n);
+    if constexpr (relocate_bitwise<Alloc, T>) {
+        destroy(alloc, data + index, data + index + n);
+        std::memmove(static_cast<void*>(data + index), static_cast<const void*>(data + index + n),
+                     (size - index - n) * sizeof(T));
+    } else {
+        // 后续元素移动赋值前移，只销毁末尾多出来的部分
+        std::move(data + index + n, data + size, data + index);
+        destroy(alloc, data + size - n, data + size);
+    }
+}
+
+// 线性查找：算术类型走 simd_search.hpp 中的向量化内核，其他类型逐个比较
+template <typename T>
+const T* find(const T* first, const T* last, const T& value) {
+    if constexpr (simd_detail::searchable<T>) {
+        return simd_detail::find<T>(first, last, value);
+    } else {
+        for (; first != last; ++first) {
+            if (*first == value) break;
+        }
+        return first;
+    }
+}
+
+template <typename T>
+size_t count(const T* first, const T* last, const T& value) {
+    if constexpr (simd_detail::searchable<T>) {
+        return simd_detail::count<T>(first, last, value);
+    } else {
+        size_t n = 0;
+        for (; first != last; ++first) {
+            if (*first == value) ++n;
+        }
+        return n;
+    }
+}
+
+template <typename T>
+const T* find_first_of(const T* first, const T* last, const T* keys, size_t key_count) {
+    if constexpr (simd_detail::searchable<T>) {
+        return simd_detail::find_first_of<T>(first, last, keys, key_count);
+    } else {
+        for (; first != last; ++first) {
+            for (size_t k = 0; k < key_count; ++k) {
+                if (*first == keys[k]) return first;
+            }
+        }
+        return last;
+    }
+}
+
+template <typename T>
+const T* min_element(const T* first, const T* last) {
+    if constexpr (simd_detail::searchable<T>) {
+        return simd_detail::min_element<T>(first, last);
+    } else {
+        return std::min_element(first, last);
+    }
+}
+
 template <typename T>
+const T* max_element(const T* first, const T* last) {
+    if constexpr (simd_detail::searchable<T>) {
+        return simd_detail::max_element<T>(first, last);
+    } else {
+        return std::max_element(first, last);
+    }
+}
+
+// Vector 系列容器的迭代器：包装裸指针，满足 std::contiguous_iterator，
+// 标准算法和 ranges 因此能识别连续存储并走 memmove/向量化的快速路径。
+// U 为 const T 时是常量迭代器，非常量迭代器可以隐式转换过去
+template <typename U>
+class vector_iterator {
+    U* ptr;
+public:
+    using iterator_concept = std::contiguous_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_cv_t<U>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = U*;
+    using reference = U&;
+
+    vector_iterator() noexcept : ptr(nullptr) {}
+    explicit vector_iterator(U* ptr) noexcept : ptr(ptr) {}
+    template <typename V>
+        requires (!std::is_same_v<V, U> && std::is_convertible_v<V*, U*>)
+    vector_iterator(const vector_iterator<V>& other) noexcept : ptr(other.operator->()) {}
+
+    U& operator*() const noexcept { return *ptr; }
+    U* operator->() const noexcept { return ptr; }
+    U& operator[](difference_type n) const noexcept { return ptr[n]; }
+    vector_iterator& operator++() noexcept { ++ptr; return *this; }//前缀加
+    vector_iterator operator++(int) noexcept { vector_iterator tmp = *this; ++ptr; return tmp; }//后缀加
+    vector_iterator& operator--() noexcept { --ptr; return *this; }//前缀减
+    vector_iterator operator--(int) noexcept { vector_iterator tmp = *this; --ptr; return tmp; }//后缀减
+    vector_iterator& operator+=(difference_type n) noexcept { ptr += n; return *this; }
+    vector_iterator& operator-=(difference_type n) noexcept { ptr -= n; return *this; }
+    friend vector_iterator operator+(vector_iterator it, difference_type n) noexcept { return it += n; }
+    friend vector_iterator operator+(difference_type n, vector_iterator it) noexcept { return it += n; }
+    friend vector_iterator operator-(vector_iterator it, difference_type n) noexcept { return it -= n; }
+    friend difference_type operator-(const vector_iterator& a, const vector_iterator& b) noexcept { return a.ptr - b.ptr; }
+    friend bool operator==(const vector_iterator& a, const vector_iterator& b) noexcept { return a.ptr == b.ptr; }
+    friend std::strong_ordering operator<=>(const vector_iterator& a, const vector_iterator& b) noexcept {
+        return std::compare_three_way()(a.ptr, b.ptr);
+    }
+};
+
+} // namespace vector_detail
+
+template <typename T, typename Alloc = std::allocator<T>>
 class Vector {
 public:
-    class iterator {
-        T* ptr;
-    public:
-        explicit iterator(T* ptr) : ptr(ptr) {}
-        T& operator*() const { return *ptr; }
-        T* operator->() const { return ptr; }
-        iterator& operator++() { ++ptr; return *this; }//前缀加
-        iterator operator++(int) { iterator tmp = *this; ++(*this); return tmp; }//后缀加
-        iterator& operator--() { --ptr; return *this; }//前缀减
-        iterator operator--(int) { iterator tmp = *this; --(*this); return tmp; }//后缀减
-        bool operator==(const iterator& other) const { return ptr == other.ptr; }
-        bool operator!=(const iterator& other) const { return ptr != other.ptr; }
-        iterator operator+(size_t n) const { return iterator(ptr + n); }
-        iterator operator-(size_t n) const { return iterator(ptr - n); }
-
-    };
-    class const_iterator : public iterator {
-    public:
-        explicit const_iterator(const T* ptr) : iterator(ptr) {}
-        const T& operator*() const { return iterator::operator*(); }
-        const T* operator->() const { return iterator::operator->(); }
-    };
+    using iterator = vector_detail::vector_iterator<T>;
+    using const_iterator = vector_detail::vector_iterator<const T>;
 private:
-    T* data;
+    using alloc_traits = std::allocator_traits<Alloc>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, T>,
+                  "Vector<T, Alloc> 要求 Alloc::value_type 与 T 一致");
+
+    T* vec_data;
     size_t vec_size;
     size_t vec_capacity;
-    std::allocator<T> allocator;
-    // 扩容函数声明
-    void reserve(size_t new_capacity);
-    // 快速排序函数声明
-    template<typename Compare>
-    void quick_sort(iterator first, iterator last, Compare cmp);
+    [[no_unique_address]] Alloc allocator;
+    // 下一次扩容的目标容量
+    [[nodiscard]] size_t next_capacity() const noexcept;
+    // 申请能容纳 n 个元素的新内存，并记录分配统计
+    T* allocate_storage(size_t n);
+    // 换用新内存：释放旧内存（元素必须已经搬走或销毁）
+    void replace_storage(T* new_data, size_t new_capacity) noexcept;
+    // 元素个数缩减到 used 后，让支持的分配器回收多余的物理页（容量不变）
+    void discard_unused(size_t used) noexcept;
+    // 容量已满时的插入：在新内存中先构造新元素，再把两侧旧元素重定位过去
+    template<typename... Args>
+    void realloc_insert(size_t index, Args&&... args);
+    // 在 index 处插入 first 开始的 n 个元素，最多一次扩容
+    template<typename ForwardIt>
+    iterator insert_n(size_t index, ForwardIt first, size_t n);
+    // 用 first 开始的 n 个元素替换全部内容
+    template<typename ForwardIt>
+    void assign_n(ForwardIt first, size_t n);
+    // 从另一个容器逐个移动元素（分配器不相等、无法直接接管内存时使用）
+    void move_elements_from(Vector& other);
 public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
     // 构造函数声明
-    Vector() noexcept;
-    explicit Vector(size_t n);
-    Vector(size_t n, const T& val);
-    Vector(std::initializer_list<T> init);
-    Vector(iterator begin, iterator end);
-    Vector(const Vector<T>& other);
-    Vector(Vector<T>&& other) noexcept;
+    Vector() noexcept(noexcept(Alloc()));
+    explicit Vector(const Alloc& alloc) noexcept;
+    explicit Vector(size_t n, const Alloc& alloc = Alloc());
+    Vector(size_t n, const T& val, const Alloc& alloc = Alloc());
+    Vector(std::initializer_list<T> init, const Alloc& alloc = Alloc());
+    Vector(iterator begin, iterator end, const Alloc& alloc = Alloc());
+    Vector(const Vector<T, Alloc>& other);
+    Vector(const Vector<T, Alloc>& other, const Alloc& alloc);
+    Vector(Vector<T, Alloc>&& other) noexcept;
+    Vector(Vector<T, Alloc>&& other, const Alloc& alloc);
     // 赋值运算符声明
-    Vector& operator=(const Vector<T>& other);
-    Vector& operator=(Vector<T>&& other) noexcept;
+    Vector& operator=(const Vector<T, Alloc>& other);
+    Vector& operator=(Vector<T, Alloc>&& other) noexcept(
+        alloc_traits::propagate_on_container_move_assignment::value ||
+        alloc_traits::is_always_equal::value);
     // 析构函数声明
     ~Vector();
     // 迭代器函数声明
     iterator begin();
+    const_iterator begin() const;
+    const_iterator cbegin() const;
     const_iterator const_begin() const;
     iterator end();
+    const_iterator end() const;
+    const_iterator cend() const;
     const_iterator const_end() const;
-    // 访问元素函数声明
+    // 访问元素函数声明。operator[] 默认检查越界，定义 MYSTL_VECTOR_UNCHECKED 后不再检查，
+    // 热循环中没有了抛异常的分支，编译器可以自动向量化；at() 始终检查
     T& operator[](size_t index);
+    const T& operator[](size_t index) const;
     T& at(size_t index);
+    const T& at(size_t index) const;
+    // 底层连续存储的首地址
+    T* data() noexcept;
+    const T* data() const noexcept;
+    // 不检查越界的连续视图；容器本身也满足 contiguous_range，可以直接转换为 std::span
+    std::span<T> as_span() noexcept;
+    std::span<const T> as_span() const noexcept;
     // 容量和大小函数声明
     [[nodiscard]] size_t capacity() const;
     void set_capacity(size_t new_capacity);
+    // 扩容函数声明
+    void reserve(size_t new_capacity);
+    // 释放多余容量
+    void shrink_to_fit();
     [[nodiscard]] bool empty() const;
     [[nodiscard]] size_t size() const;
+    // 调整元素个数：新增元素值初始化或由 value 拷贝构造
+    void resize(size_t n);
+    void resize(size_t n, const T& value);
+    // 调整元素个数，新增元素只做默认初始化（平凡类型不清零），调用方随后覆盖写入
+    void resize_for_overwrite(size_t n);
     // 清空函数声明
     void clear();
     // 添加元素函数声明
@@ -77,297 +507,627 @@ public:
     // 添加元素函数声明，直接构造
     template<typename... Args>
     void emplace_back(Args&&... args);
-    // 查找元素函数声明
+    // 查找元素函数声明（算术类型使用 SIMD 内核）
     const_iterator find(const T& value) const;
-    // 插入元素函数声明
-    void insert(iterator pos, const T& value);
-    // 删除元素函数声明
-    void erase(iterator pos);
+    [[nodiscard]] size_t count(const T& value) const;
+    [[nodiscard]] bool contains(const T& value) const;
+    // 查找第一个等于任一 key 的元素
+    const_iterator find_first_of(const T* keys, size_t key_count) const;
+    const_iterator find_first_of(std::initializer_list<T> keys) const;
+    // 按谓词查找/计数，谓词以 FunctionRef 传入，不为每个 lambda 实例化一份
+    const_iterator find_if(FunctionRef<bool(const T&)> pred) const;
+    [[nodiscard]] size_t count_if(FunctionRef<bool(const T&)> pred) const;
+    // 最小、最大元素，容器为空时返回 const_end()
+    const_iterator min_element() const;
+    const_iterator max_element() const;
+    // 插入元素函数声明，返回指向第一个新元素的迭代器
+    iterator insert(iterator pos, const T& value);
+    iterator insert(iterator pos, T&& value);
+    iterator insert(iterator pos, size_t n, const T& value);
+    // 区间插入：最多一次扩容、一次整体后移。区间不能来自本容器
+    template<vector_detail::iterator_like InputIt>
+    iterator insert(iterator pos, InputIt first, InputIt last);
+    iterator insert(iterator pos, std::initializer_list<T> init);
+    // 在指定位置直接构造元素
+    template<typename... Args>
+    iterator emplace(iterator pos, Args&&... args);
+    // 在末尾追加一个区间
+    template<vector_detail::iterator_like InputIt>
+    void append(InputIt first, InputIt last);
+    void append(std::initializer_list<T> init);
+    // 整体替换内容，容量足够时复用现有内存
+    void assign(size_t n, const T& value);
+    template<vector_detail::iterator_like InputIt>
+    void assign(InputIt first, InputIt last);
+    void assign(std::initializer_list<T> init);
+    // 删除元素函数声明，返回指向被删除元素之后元素的迭代器
+    iterator erase(iterator pos);
+    iterator erase(iterator first, iterator last);
     void pop_back();
     // 访问首尾元素函数声明
     T& front() const;
     T& back() const;
     // 交换函数声明
     void swap(Vector& other) noexcept;
+    // 分配器访问函数声明
+    allocator_type get_allocator() const noexcept;
     // 友元函数声明
-    template <typename U>
-    friend std::ostream& operator<<(std::ostream& os, const Vector<U>& vec);
-    // 快速排序函数声明
+    template <typename U, typename A>
+    friend std::ostream& operator<<(std::ostream& os, const Vector<U, A>& vec);
+    // 排序函数声明（pdqsort，不稳定）
     template<typename Compare = std::less<T>>
     void sort(iterator first, iterator last, Compare cmp = Compare());
     // 函数重写
     template<typename Compare = std::less<T>>
     void sort(Compare cmp = Compare());
+    // 稳定排序函数声明（归并排序）
+    template<typename Compare = std::less<T>>
+    void stable_sort(iterator first, iterator last, Compare cmp = Compare());
+    template<typename Compare = std::less<T>>
+    void stable_sort(Compare cmp = Compare());
+    // 基数排序函数声明：key(element) 返回整数或浮点数，默认以元素本身为键。
+    // radix_sort 为稳定的 LSD 排序（需要 O(n) 额外空间），
+    // msd_radix_sort 为不稳定的原地 MSD 排序，键还可以是字节串（返回引用或 std::string_view）
+    template<typename KeyFn = radix_detail::identity_key>
+    void radix_sort(KeyFn key = KeyFn());
+    template<typename KeyFn = radix_detail::identity_key>
+    void msd_radix_sort(KeyFn key = KeyFn());
 };
 
-template <typename T>
-void Vector<T>::set_capacity(size_t new_capacity) {
+template <typename T, typename Alloc>
+void Vector<T, Alloc>::set_capacity(size_t new_capacity) {
     if (new_capacity <= vec_capacity) return;  // 只在需要扩容时执行
     reserve(new_capacity);
 }
 
-// 扩容函数实现
-template <typename T>
-void Vector<T>::reserve(size_t new_capacity) {
+// 扩容函数实现，失败时原有内容保持不变
+template <typename T, typename Alloc>
+void Vector<T, Alloc>::reserve(size_t new_capacity) {
     if (new_capacity <= vec_capacity) return;  // 只在需要扩容时执行
 
-    T* new_data = std::allocator_traits<std::allocator<T>>::allocate(allocator, new_capacity);
-    // 移动现有元素
-    for (size_t i = 0; i < vec_size; i++) {
-        std::allocator_traits<std::allocator<T>>::construct(allocator, &new_data[i], std::move(data[i]));
-        // std::allocator_traits<std::allocator<T>>::construct(allocator, &new_data[i], data[i]);
-        std::allocator_traits<std::allocator<T>>::destroy(allocator, &data[i]);
+    if constexpr (vector_detail::reallocate_in_place<Alloc, T>) {
+        if (vec_data) {
+            vec_data = allocator.reallocate(vec_data, vec_capacity, new_capacity);
+            vector_telemetry::record_allocation<T>(new_capacity, vec_size > 0);
+            vec_capacity = new_capacity;
+            return;
+        }
     }
-    // 释放旧内存
-    if (data) {
-        std::allocator_traits<std::allocator<T>>::deallocate(allocator, data, vec_capacity);
+    T* new_data = allocate_storage(new_capacity);
+    // 重定位现有元素：可平凡重定位类型整块 memcpy，否则逐个 move_if_noexcept
+    try {
+        vector_detail::uninitialized_relocate(allocator, vec_data, vec_data + vec_size, new_data);
+    } catch (...) {
+        alloc_traits::deallocate(allocator, new_data, new_capacity);
+        throw;
     }
-    data = new_data;
+    replace_storage(new_data, new_capacity);
+}
+
+template <typename T, typename Alloc>
+size_t Vector<T, Alloc>::next_capacity() const noexcept {
+    return (vec_capacity == 0) ? 1 : 2 * vec_capacity;
+}
+
+template <typename T, typename Alloc>
+T* Vector<T, Alloc>::allocate_storage(size_t n) {
+    T* p = alloc_traits::allocate(allocator, n);
+    // 已有元素需要搬到新内存时算作一次扩容
+    vector_telemetry::record_allocation<T>(n, vec_size > 0);
+    return p;
+}
+
+template <typename T, typename Alloc>
+void Vector<T, Alloc>::discard_unused(size_t used) noexcept {
+    if constexpr (vector_detail::allocator_discards<Alloc, T>) {
+        allocator.discard(vec_data, vec_capacity, used);
+    } else {
+        (void)used;
+    }
+}
+
+template <typename T, typename Alloc>
+void Vector<T, Alloc>::replace_storage(T* new_data, size_t new_capacity) noexcept {
+    if (vec_data) {
+        alloc_traits::deallocate(allocator, vec_data, vec_capacity);
+    }
+    vec_data = new_data;
     vec_capacity = new_capacity;
 }
 
+template <typename T, typename Alloc>
+template <typename... Args>
+void Vector<T, Alloc>::realloc_insert(size_t index, Args&&... args) {
+    if constexpr (vector_detail::reallocate_in_place<Alloc, T>) {
+        // 原地扩容后 args 可能引用已失效的地址，先构造临时对象
+        T tmp(std::forward<Args>(args)...);
+        reserve(next_capacity());
+        if (index == vec_size) {
+            alloc_traits::construct(allocator, vec_data + vec_size, std::move(tmp));
+        } else {
+            vector_detail::insert_in_place(allocator, vec_data, vec_size, index, tmp);
+        }
+        ++vec_size;
+        return;
+    }
+    size_t new_capacity = next_capacity();
+    T* new_data = allocate_storage(new_capacity);
+    try {
+        vector_detail::relocate_with_insert(allocator, vec_data, vec_size, index, new_data, std::forward<Args>(args)...);
+    } catch (...) {
+        alloc_traits::deallocate(allocator, new_data, new_capacity);
+        throw;
+    }
+    replace_storage(new_data, new_capacity);
+    ++vec_size;
+}
+
+template <typename T, typename Alloc>
+template <typename ForwardIt>
+typename Vector<T, Alloc>::iterator Vector<T, Alloc>::insert_n(size_t index, ForwardIt first, size_t n) {
+    if (n == 0) return iterator(vec_data + index);
+    if constexpr (vector_detail::reallocate_in_place<Alloc, T>) {
+        if (n > vec_capacity - vec_size) {
+            reserve(std::max(vec_size + n, next_capacity()));
+        }
+    }
+    if (n > vec_capacity - vec_size) {
+        size_t new_capacity = std::max(vec_size + n, next_capacity());
+        T* new_data = allocate_storage(new_capacity);
+        try {
+            vector_detail::relocate_with_gap(allocator, vec_data, vec_size, index, new_data, n, [&](T* dest) {
+                vector_detail::uninitialized_copy_n(allocator, first, n, dest);
+            });
+        } catch (...) {
+            alloc_traits::deallocate(allocator, new_data, new_capacity);
+            throw;
+        }
+        replace_storage(new_data, new_capacity);
+    } else {
+        vector_detail::insert_range_in_place(allocator, vec_data, vec_size, index, first, n);
+    }
+    vec_size += n;
+    return iterator(vec_data + index);
+}
+
+template <typename T, typename Alloc>
+template <typename ForwardIt>
+void Vector<T, Alloc>::assign_n(ForwardIt first, size_t n) {
+    if (n > vec_capacity) {
+        // 先在新内存中构造好全部元素，再销毁旧内容
+        T* new_data = allocate_storage(n);
+        try {
+            vector_detail::uninitialized_copy_n(allocator, first, n, new_data);
+        } catch (...) {
+            alloc_traits::deallocate(allocator, new_data, n);
+            throw;
+        }
+        vector_detail::destroy(allocator, vec_data, vec_data + vec_size);
+        replace_storage(new_data, n);
+        vec_size = n;
+        return;
+    }
+    size_t common = std::min(n, vec_size);
+    for (size_t i = 0; i < common; ++i, ++first) {
+        vec_data[i] = *first;
+    }
+    if (n > vec_size) {
+        vector_detail::uninitialized_copy_n(allocator, first, n - vec_size, vec_data + vec_size);
+    } else {
+        vector_detail::destroy(allocator, vec_data + n, vec_data + vec_size);
+    }
+    vec_size = n;
+}
+
 
 // 默认构造函数实现
-template <typename T>
-Vector<T>::Vector() noexcept : data(nullptr), vec_size(0), vec_capacity(0) {
-    std::cout << "默认构造函数" << std::endl;
+template <typename T, typename Alloc>
+Vector<T, Alloc>::Vector() noexcept(noexcept(Alloc())) : vec_data(nullptr), vec_size(0), vec_capacity(0), allocator() {
+}
+
+// 分配器构造函数实现
+template <typename T, typename Alloc>
+Vector<T, Alloc>::Vector(const Alloc& alloc) noexcept : vec_data(nullptr), vec_size(0), vec_capacity(0), allocator(alloc) {
 }
 
+// 以下构造函数都委托给分配器构造函数：元素构造抛出异常时析构函数会运行，
+// 释放缓冲区并销毁已经构造的 vec_size 个元素
+
 // 显式构造函数实现
-template <typename T>
-Vector<T>::Vector(size_t n) : data(nullptr), vec_size(0), vec_capacity(0) {
+template <typename T, typename Alloc>
+Vector<T, Alloc>::Vector(size_t n, const Alloc& alloc) : Vector(alloc) {
     reserve(n);
-    vec_size = n;
-    for (size_t i = 0; i < n; ++i) {
-        std::allocator_traits<std::allocator<T>>::construct(allocator, &data[i]);
+    for (; vec_size < n; ++vec_size) {
+        alloc_traits::construct(allocator, &vec_data[vec_size]);
     }
-    std::cout << "显式构造函数" << std::endl;
 }
 
 // 直接构造函数实现
-template <typename T>
-Vector<T>::Vector(size_t n, const T& val) : data(nullptr), vec_size(0), vec_capacity(0) {
+template <typename T, typename Alloc>
+Vector<T, Alloc>::Vector(size_t n, const T& val, const Alloc& alloc) : Vector(alloc) {
     reserve(n);
-    vec_size = n;
-    std::uninitialized_fill_n(data, n, val);
-    std::cout << "直接构造函数" << std::endl;
+    for (; vec_size < n; ++vec_size) {
+        alloc_traits::construct(allocator, &vec_data[vec_size], val);
+    }
 }
 
 // 初始化列表构造函数实现
-template <typename T>
-Vector<T>::Vector(std::initializer_list<T> init) : data(nullptr), vec_size(0), vec_capacity(0) {
+template <typename T, typename Alloc>
+Vector<T, Alloc>::Vector(std::initializer_list<T> init, const Alloc& alloc) : Vector(alloc) {
     if (init.size() > 0) {
         reserve(init.size());
-        for (size_t i = 0; i < init.size(); ++i) {
-            std::allocator_traits<std::allocator<T>>::construct(allocator, &data[i], *(init.begin() + i));
+        for (const T& value : init) {
+            alloc_traits::construct(allocator, &vec_data[vec_size], value);
+            ++vec_size;
         }
-        vec_size = init.size();
     }
-    std::cout << "初始化列表构造函数" << std::endl;
 }
 
 // 迭代器构造函数实现
-template <typename T>
-Vector<T>::Vector(iterator begin, iterator end) : data(nullptr), vec_size(0), vec_capacity(0) {
+template <typename T, typename Alloc>
+Vector<T, Alloc>::Vector(iterator begin, iterator end, const Alloc& alloc) : Vector(alloc) {
     size_t count = end - begin;
     reserve(count);
-    for (size_t i = 0; i < count; ++i) {
-        std::allocator_traits<std::allocator<T>>::construct(allocator, &data[i], *(begin + i));
+    for (; vec_size < count; ++vec_size) {
+        alloc_traits::construct(allocator, &vec_data[vec_size], *(begin + vec_size));
     }
-    vec_size = count;
-    std::cout << "迭代器构造函数" << std::endl;
 }
 
-// 拷贝构造函数实现
-template <typename T>
-Vector<T>::Vector(const Vector<T>& other) : data(nullptr), vec_size(0), vec_capacity(0) {
+// 拷贝构造函数实现，分配器由 select_on_container_copy_construction 决定
+template <typename T, typename Alloc>
+Vector<T, Alloc>::Vector(const Vector<T, Alloc>& other)
+    : Vector(other, alloc_traits::select_on_container_copy_construction(other.allocator)) {
+}
+
+// 带分配器的拷贝构造函数实现
+template <typename T, typename Alloc>
+Vector<T, Alloc>::Vector(const Vector<T, Alloc>& other, const Alloc& alloc) : Vector(alloc) {
     reserve(other.vec_size);
-    for (size_t i = 0; i < other.vec_size; ++i) {
-        std::allocator_traits<std::allocator<T>>::construct(allocator, &data[i], other.data[i]);
+    for (; vec_size < other.vec_size; ++vec_size) {
+        alloc_traits::construct(allocator, &vec_data[vec_size], other.vec_data[vec_size]);
     }
-    vec_size = other.vec_size;
-    std::cout << "拷贝构造函数" << std::endl;
+    vector_telemetry::record_copied<T>(other.vec_size);
 }
 
 // 移动构造函数实现
-template <typename T>
-Vector<T>::Vector(Vector<T>&& other) noexcept : 
-    data(other.data),
+template <typename T, typename Alloc>
+Vector<T, Alloc>::Vector(Vector<T, Alloc>&& other) noexcept : 
+    vec_data(other.vec_data),
     vec_size(other.vec_size),
     vec_capacity(other.vec_capacity),
     allocator(std::move(other.allocator)) {
     // 防止 other 析构时释放我们刚"偷"来的内存
-    other.data = nullptr;
+    other.vec_data = nullptr;
     other.vec_size = 0;
     other.vec_capacity = 0;
-    std::cout << "移动构造函数" << std::endl;
+}
+
+// 带分配器的移动构造函数实现：分配器相等时接管内存，否则只能逐个移动元素
+template <typename T, typename Alloc>
+Vector<T, Alloc>::Vector(Vector<T, Alloc>&& other, const Alloc& alloc) : Vector(alloc) {
+    if (alloc_traits::is_always_equal::value || allocator == other.allocator) {
+        vec_data = other.vec_data;
+        vec_size = other.vec_size;
+        vec_capacity = other.vec_capacity;
+        other.vec_data = nullptr;
+        other.vec_size = 0;
+        other.vec_capacity = 0;
+    } else {
+        move_elements_from(other);
+    }
+}
+
+// 逐个移动元素实现，完成后 other 被清空
+template <typename T, typename Alloc>
+void Vector<T, Alloc>::move_elements_from(Vector& other) {
+    reserve(other.vec_size);
+    for (; vec_size < other.vec_size; ++vec_size) {
+        alloc_traits::construct(allocator, &vec_data[vec_size], std::move(other.vec_data[vec_size]));
+    }
+    vector_telemetry::record_moved<T>(vec_size);
+    other.clear();
 }
 
 // 拷贝赋值运算符实现
-template <typename T>
-Vector<T>& Vector<T>::operator=(const Vector<T>& other) {
+template <typename T, typename Alloc>
+Vector<T, Alloc>& Vector<T, Alloc>::operator=(const Vector<T, Alloc>& other) {
     if (this != &other) {
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+            // 分配器要随赋值传播：旧内存必须先由旧分配器释放
+            if (!alloc_traits::is_always_equal::value && allocator != other.allocator) {
+                clear();
+            }
+            allocator = other.allocator;
+        }
         // 如果现有容量足够，直接复用内存
         if (vec_capacity >= other.vec_size) {
             // 复制共同部分
             for (size_t i = 0; i < std::min(vec_size, other.vec_size); ++i) {
-                data[i] = other.data[i];
+                vec_data[i] = other.vec_data[i];
             }
             
             // 如果新大小更大，构造额外元素
             for (size_t i = vec_size; i < other.vec_size; ++i) {
-                std::allocator_traits<std::allocator<T>>::construct(allocator, &data[i], other.data[i]);
+                alloc_traits::construct(allocator, &vec_data[i], other.vec_data[i]);
             }
             
             // 如果新大小更小，销毁多余元素
             for (size_t i = other.vec_size; i < vec_size; ++i) {
-                std::allocator_traits<std::allocator<T>>::destroy(allocator, &data[i]);
+                alloc_traits::destroy(allocator, &vec_data[i]);
             }
         } else {
             // 需要重新分配内存
             clear();
             reserve(other.vec_size);
             for (size_t i = 0; i < other.vec_size; ++i) {
-                std::allocator_traits<std::allocator<T>>::construct(allocator, &data[i], other.data[i]);
+                alloc_traits::construct(allocator, &vec_data[i], other.vec_data[i]);
             }
         }
         
         vec_size = other.vec_size;
+        vector_telemetry::record_copied<T>(other.vec_size);
     }
-    std::cout << "拷贝赋值运算符" << std::endl;
     return *this;
 }
 
 // 移动赋值运算符实现
-template <typename T>
-Vector<T>& Vector<T>::operator=(Vector<T>&& other) noexcept {
+template <typename T, typename Alloc>
+Vector<T, Alloc>& Vector<T, Alloc>::operator=(Vector<T, Alloc>&& other) noexcept(
+    alloc_traits::propagate_on_container_move_assignment::value ||
+    alloc_traits::is_always_equal::value) {
     if (this != &other) {
         clear();  // 释放当前资源
-        
-        // 窃取资源
-        data = other.data;
-        vec_size = other.vec_size;
-        vec_capacity = other.vec_capacity;
-        allocator = std::move(other.allocator);
-        
-        // 重置 other
-        other.data = nullptr;
-        other.vec_size = 0;
-        other.vec_capacity = 0;
+
+        constexpr bool propagate = alloc_traits::propagate_on_container_move_assignment::value;
+        if (propagate || alloc_traits::is_always_equal::value || allocator == other.allocator) {
+            // 窃取资源
+            vec_data = other.vec_data;
+            vec_size = other.vec_size;
+            vec_capacity = other.vec_capacity;
+            if constexpr (propagate) {
+                allocator = std::move(other.allocator);
+            }
+
+            // 重置 other
+            other.vec_data = nullptr;
+            other.vec_size = 0;
+            other.vec_capacity = 0;
+        } else {
+            // 分配器不传播且不相等：other 的内存不能由我们的分配器释放
+            move_elements_from(other);
+        }
     }
-    std::cout << "移动赋值运算符" << std::endl;
     return *this;
 }
 
 // 析构函数实现
-template <typename T>
-Vector<T>::~Vector() {
+template <typename T, typename Alloc>
+Vector<T, Alloc>::~Vector() {
     clear();
-    std::cout << "析构函数" << std::endl;
 }
 
 // 迭代器函数实现
-template <typename T>
-typename Vector<T>::iterator Vector<T>::begin() {
-    return iterator(data);
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::iterator Vector<T, Alloc>::begin() {
+    return iterator(vec_data);
 }
 
-template <typename T>
-typename Vector<T>::const_iterator Vector<T>::const_begin() const {
-    return const_iterator(data);
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::const_iterator Vector<T, Alloc>::begin() const {
+    return const_iterator(vec_data);
 }
 
-template <typename T>
-typename Vector<T>::iterator Vector<T>::end() {
-    return iterator(data + vec_size);
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::const_iterator Vector<T, Alloc>::cbegin() const {
+    return const_iterator(vec_data);
 }
 
-template <typename T>
-typename Vector<T>::const_iterator Vector<T>::const_end() const {
-    return const_iterator(data + vec_size);
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::const_iterator Vector<T, Alloc>::const_begin() const {
+    return const_iterator(vec_data);
+}
+
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::iterator Vector<T, Alloc>::end() {
+    return iterator(vec_data + vec_size);
+}
+
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::const_iterator Vector<T, Alloc>::end() const {
+    return const_iterator(vec_data + vec_size);
+}
+
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::const_iterator Vector<T, Alloc>::cend() const {
+    return const_iterator(vec_data + vec_size);
+}
+
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::const_iterator Vector<T, Alloc>::const_end() const {
+    return const_iterator(vec_data + vec_size);
 }
 
 // 访问元素函数实现
-template <typename T>
-T& Vector<T>::operator[](size_t index) {
+template <typename T, typename Alloc>
+T& Vector<T, Alloc>::operator[](size_t index) {
+#ifndef MYSTL_VECTOR_UNCHECKED
     if (index >= vec_size) {
         throw std::out_of_range("Vector::operator[]");
     }
-    return *(data+index);
+#endif
+    return vec_data[index];
 }
 
-template <typename T>
-T& Vector<T>::at(size_t index) {
+template <typename T, typename Alloc>
+const T& Vector<T, Alloc>::operator[](size_t index) const {
+#ifndef MYSTL_VECTOR_UNCHECKED
+    if (index >= vec_size) {
+        throw std::out_of_range("Vector::operator[]");
+    }
+#endif
+    return vec_data[index];
+}
+
+template <typename T, typename Alloc>
+T& Vector<T, Alloc>::at(size_t index) {
+    if (index >= vec_size) {
+        throw std::out_of_range("Vector::at");
+    }
+    return *(vec_data+index);
+}
+
+template <typename T, typename Alloc>
+const T& Vector<T, Alloc>::at(size_t index) const {
     if (index >= vec_size) {
         throw std::out_of_range("Vector::at");
     }
-    return *(data+index);
+    return vec_data[index];
+}
+
+template <typename T, typename Alloc>
+T* Vector<T, Alloc>::data() noexcept {
+    return vec_data;
+}
+
+template <typename T, typename Alloc>
+const T* Vector<T, Alloc>::data() const noexcept {
+    return vec_data;
+}
+
+template <typename T, typename Alloc>
+std::span<T> Vector<T, Alloc>::as_span() noexcept {
+    return std::span<T>(vec_data, vec_size);
+}
+
+template <typename T, typename Alloc>
+std::span<const T> Vector<T, Alloc>::as_span() const noexcept {
+    return std::span<const T>(vec_data, vec_size);
 }
 
 // 容量和大小函数实现
-template <typename T>
-size_t Vector<T>::capacity() const {
+template <typename T, typename Alloc>
+size_t Vector<T, Alloc>::capacity() const {
     return vec_capacity;
 }
 
-template <typename T>
-bool Vector<T>::empty() const {
+template <typename T, typename Alloc>
+bool Vector<T, Alloc>::empty() const {
     return vec_size == 0;
 }
 
-template <typename T>
-size_t Vector<T>::size() const {
+template <typename T, typename Alloc>
+size_t Vector<T, Alloc>::size() const {
     return vec_size;
 }
 
+// 释放多余容量函数实现
+template <typename T, typename Alloc>
+void Vector<T, Alloc>::shrink_to_fit() {
+    if (vec_size == vec_capacity) return;
+    if (vec_size == 0) {
+        replace_storage(nullptr, 0);
+        return;
+    }
+    if constexpr (vector_detail::reallocate_in_place<Alloc, T>) {
+        vec_data = allocator.reallocate(vec_data, vec_capacity, vec_size);
+        vec_capacity = vec_size;
+        return;
+    }
+    T* new_data = allocate_storage(vec_size);
+    try {
+        vector_detail::uninitialized_relocate(allocator, vec_data, vec_data + vec_size, new_data);
+    } catch (...) {
+        alloc_traits::deallocate(allocator, new_data, vec_size);
+        throw;
+    }
+    replace_storage(new_data, vec_size);
+}
+
+template <typename T, typename Alloc>
+void Vector<T, Alloc>::resize(size_t n) {
+    if (n <= vec_size) {
+        vector_detail::destroy(allocator, vec_data + n, vec_data + vec_size);
+        discard_unused(n);
+    } else {
+        if (n > vec_capacity) {
+            reserve(std::max(n, next_capacity()));
+        }
+        vector_detail::uninitialized_value_construct_n(allocator, vec_data + vec_size, n - vec_size);
+    }
+    vec_size = n;
+}
+
+template <typename T, typename Alloc>
+void Vector<T, Alloc>::resize(size_t n, const T& value) {
+    if (n <= vec_size) {
+        vector_detail::destroy(allocator, vec_data + n, vec_data + vec_size);
+        discard_unused(n);
+        vec_size = n;
+        return;
+    }
+    // value 可能引用扩容时被搬走的元素，先复制一份
+    T tmp(value);
+    if (n > vec_capacity) {
+        reserve(std::max(n, next_capacity()));
+    }
+    vector_detail::uninitialized_copy_n(allocator, vector_detail::repeat_iterator<T>(&tmp, 0), n - vec_size, vec_data + vec_size);
+    vec_size = n;
+}
+
+template <typename T, typename Alloc>
+void Vector<T, Alloc>::resize_for_overwrite(size_t n) {
+    if (n <= vec_size) {
+        vector_detail::destroy(allocator, vec_data + n, vec_data + vec_size);
+        discard_unused(n);
+    } else {
+        if (n > vec_capacity) {
+            reserve(std::max(n, next_capacity()));
+        }
+        vector_detail::uninitialized_default_construct_n(allocator, vec_data + vec_size, n - vec_size);
+    }
+    vec_size = n;
+}
+
 // 清空函数实现
-template <typename T>
-void Vector<T>::clear() {
+template <typename T, typename Alloc>
+void Vector<T, Alloc>::clear() {
     for (size_t i = 0; i < vec_size; i++) {
-        std::allocator_traits<std::allocator<T>>::destroy(allocator, &data[i]);
+        alloc_traits::destroy(allocator, &vec_data[i]);
     }
-    if (data) {
-        std::allocator_traits<std::allocator<T>>::deallocate(allocator, data, vec_capacity);
+    if (vec_data) {
+        alloc_traits::deallocate(allocator, vec_data, vec_capacity);
     }
-    data = nullptr;
+    vec_data = nullptr;
     vec_size = 0;
     vec_capacity = 0;
 }
 
 // 添加元素函数实现
-template <typename T>
-void Vector<T>::push_back(const T& value) {
-    if (vec_size == vec_capacity) {
-        size_t new_capacity = (vec_capacity == 0) ? 1 : 2 * vec_capacity;
-        reserve(new_capacity);
-    }
-    std::allocator_traits<std::allocator<T>>::construct(allocator, data+vec_size, value);
-    ++vec_size;
+template <typename T, typename Alloc>
+void Vector<T, Alloc>::push_back(const T& value) {
+    emplace_back(value);
+    vector_telemetry::record_copied<T>(1);
 }
 
-template <typename T>
-void Vector<T>::push_back(T&& value) {
-    if (vec_size == vec_capacity) {
-        size_t new_capacity = (vec_capacity == 0) ? 1 : 2 * vec_capacity;
-        reserve(new_capacity);
-    }
-    std::allocator_traits<std::allocator<T>>::construct(allocator, data+vec_size, std::move(value));
-    ++vec_size;
+template <typename T, typename Alloc>
+void Vector<T, Alloc>::push_back(T&& value) {
+    emplace_back(std::move(value));
 }
 
 // 添加元素函数实现，直接构造
-template <typename T>
+template <typename T, typename Alloc>
 template<typename... Args>
-void Vector<T>::emplace_back(Args&&... args) {
+void Vector<T, Alloc>::emplace_back(Args&&... args) {
     if (vec_size == vec_capacity) {
-        size_t new_capacity = (vec_capacity == 0) ? 1 : 2 * vec_capacity;
-        reserve(new_capacity);
+        // 扩容时在新内存中构造，args 引用自身元素时也安全
+        realloc_insert(vec_size, std::forward<Args>(args)...);
+        return;
     }
     
     // 使用完美转发构造新元素
-    std::allocator_traits<std::allocator<T>>::construct(
+    alloc_traits::construct(
         allocator, 
-        data + vec_size, 
+        vec_data + vec_size, 
         std::forward<Args>(args)...
     );
     
@@ -375,123 +1135,1129 @@ void Vector<T>::emplace_back(Args&&... args) {
 }
 
 // 查找元素函数实现
-template <typename T>
-typename Vector<T>::const_iterator Vector<T>::find(const T& value) const {
-    const_iterator it = const_begin();
-    for (; it != const_end(); ++it) {
-        if (*it == value) {
-            break;
-        }
-    }
-    return it;
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::const_iterator Vector<T, Alloc>::find(const T& value) const {
+    return const_iterator(vector_detail::find<T>(vec_data, vec_data + vec_size, value));
 }
 
-// 插入元素函数实现
-template <typename T>
-void Vector<T>::insert(iterator pos, const T& value) {
-    size_t index = pos - begin();
-    if (vec_size == vec_capacity) {
-        size_t new_capacity = (vec_capacity == 0) ? 1 : 2 * vec_capacity;
-        reserve(new_capacity);
+template <typename T, typename Alloc>
+size_t Vector<T, Alloc>::count(const T& value) const {
+    return vector_detail::count<T>(vec_data, vec_data + vec_size, value);
+}
+
+template <typename T, typename Alloc>
+bool Vector<T, Alloc>::contains(const T& value) const {
+    return vector_detail::find<T>(vec_data, vec_data + vec_size, value) != vec_data + vec_size;
+}
+
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::const_iterator Vector<T, Alloc>::find_first_of(const T* keys, size_t key_count) const {
+    return const_iterator(vector_detail::find_first_of<T>(vec_data, vec_data + vec_size, keys, key_count));
+}
+
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::const_iterator Vector<T, Alloc>::find_first_of(std::initializer_list<T> keys) const {
+    return find_first_of(keys.begin(), keys.size());
+}
+
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::const_iterator Vector<T, Alloc>::find_if(FunctionRef<bool(const T&)> pred) const {
+    for (size_t i = 0; i < vec_size; ++i) {
+        if (pred(vec_data[i])) return const_iterator(vec_data + i);
     }
-    for (size_t i = vec_size; i > index; --i) {
-        std::allocator_traits<std::allocator<T>>::construct(allocator, &data[i], std::move(data[i-1]));
+    return const_end();
+}
+
+template <typename T, typename Alloc>
+size_t Vector<T, Alloc>::count_if(FunctionRef<bool(const T&)> pred) const {
+    size_t n = 0;
+    for (size_t i = 0; i < vec_size; ++i) {
+        n += pred(vec_data[i]) ? 1 : 0;
     }
-    std::allocator_traits<std::allocator<T>>::construct(allocator, &data[index], value);
-    ++vec_size;
+    return n;
 }
 
-// 删除元素函数实现
-template <typename T>
-void Vector<T>::erase(iterator pos) {
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::const_iterator Vector<T, Alloc>::min_element() const {
+    return const_iterator(vector_detail::min_element<T>(vec_data, vec_data + vec_size));
+}
+
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::const_iterator Vector<T, Alloc>::max_element() const {
+    return const_iterator(vector_detail::max_element<T>(vec_data, vec_data + vec_size));
+}
+
+// 插入元素函数实现
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::iterator Vector<T, Alloc>::insert(iterator pos, const T& value) {
+    return emplace(pos, value);
+}
+
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::iterator Vector<T, Alloc>::insert(iterator pos, T&& value) {
+    return emplace(pos, std::move(value));
+}
+
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::iterator Vector<T, Alloc>::insert(iterator pos, size_t n, const T& value) {
+    // value 可能引用即将被移动的元素，先复制一份
+    T tmp(value);
+    return insert_n(pos - begin(), vector_detail::repeat_iterator<T>(&tmp, 0), n);
+}
+
+template <typename T, typename Alloc>
+template <vector_detail::iterator_like InputIt>
+typename Vector<T, Alloc>::iterator Vector<T, Alloc>::insert(iterator pos, InputIt first, InputIt last) {
     size_t index = pos - begin();
-    for (size_t i = index; i < vec_size - 1; ++i) {
-        std::allocator_traits<std::allocator<T>>::construct(allocator, &data[i], std::move(data[i+1]));
+    if constexpr (vector_detail::multipass_iterator<InputIt>) {
+        return insert_n(index, first, static_cast<size_t>(std::distance(first, last)));
+    } else {
+        // 单遍迭代器无法预先求出长度：先追加到末尾，再整体旋转到插入位置
+        size_t old_size = vec_size;
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+        std::rotate(vec_data + index, vec_data + old_size, vec_data + vec_size);
+        return iterator(vec_data + index);
     }
-    std::allocator_traits<std::allocator<T>>::destroy(allocator, &data[vec_size-1]);
-    --vec_size;
+}
+
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::iterator Vector<T, Alloc>::insert(iterator pos, std::initializer_list<T> init) {
+    return insert_n(pos - begin(), init.begin(), init.size());
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+typename Vector<T, Alloc>::iterator Vector<T, Alloc>::emplace(iterator pos, Args&&... args) {
+    size_t index = pos - begin();
+    if (vec_size == vec_capacity) {
+        realloc_insert(index, std::forward<Args>(args)...);
+    } else if (index == vec_size) {
+        alloc_traits::construct(allocator, vec_data + vec_size, std::forward<Args>(args)...);
+        ++vec_size;
+    } else {
+        // 先构造临时对象：参数可能引用即将被移动的元素
+        T tmp(std::forward<Args>(args)...);
+        vector_detail::insert_in_place(allocator, vec_data, vec_size, index, tmp);
+        ++vec_size;
+    }
+    return iterator(vec_data + index);
+}
+
+template <typename T, typename Alloc>
+template <vector_detail::iterator_like InputIt>
+void Vector<T, Alloc>::append(InputIt first, InputIt last) {
+    insert(end(), first, last);
+}
+
+template <typename T, typename Alloc>
+void Vector<T, Alloc>::append(std::initializer_list<T> init) {
+    insert_n(vec_size, init.begin(), init.size());
+}
+
+template <typename T, typename Alloc>
+void Vector<T, Alloc>::assign(size_t n, const T& value) {
+    T tmp(value);
+    assign_n(vector_detail::repeat_iterator<T>(&tmp, 0), n);
+}
+
+template <typename T, typename Alloc>
+template <vector_detail::iterator_like InputIt>
+void Vector<T, Alloc>::assign(InputIt first, InputIt last) {
+    if constexpr (vector_detail::multipass_iterator<InputIt>) {
+        assign_n(first, static_cast<size_t>(std::distance(first, last)));
+    } else {
+        vector_detail::destroy(allocator, vec_data, vec_data + vec_size);
+        vec_size = 0;
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+}
+
+template <typename T, typename Alloc>
+void Vector<T, Alloc>::assign(std::initializer_list<T> init) {
+    assign_n(init.begin(), init.size());
+}
+
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::iterator Vector<T, Alloc>::erase(iterator pos) {
+    return erase(pos, pos + 1);
+}
+
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::iterator Vector<T, Alloc>::erase(iterator first, iterator last) {
+    size_t index = first - begin();
+    size_t n = last - first;
+    vector_detail::erase_range_in_place(allocator, vec_data, vec_size, index, n);
+    vec_size -= n;
+    return iterator(vec_data + index);
 }
 
 // 删除最后一个元素函数实现
-template <typename T>
-void Vector<T>::pop_back() {
+template <typename T, typename Alloc>
+void Vector<T, Alloc>::pop_back() {
     if(vec_size == 0) {
         throw std::out_of_range("Vector::pop_back");
     }
-    std::allocator_traits<std::allocator<T>>::destroy(allocator, &data[vec_size-1]);
+    alloc_traits::destroy(allocator, &vec_data[vec_size-1]);
     --vec_size;
 }
 
 // 访问首尾元素函数实现
-template <typename T>
-T& Vector<T>::front() const {
+template <typename T, typename Alloc>
+T& Vector<T, Alloc>::front() const {
+#ifndef MYSTL_VECTOR_UNCHECKED
     if(vec_size == 0) {
         throw std::out_of_range("Vector::front");
     }
-    return data[0];
+#endif
+    return vec_data[0];
 }
 
-template <typename T>
-T& Vector<T>::back() const {
+template <typename T, typename Alloc>
+T& Vector<T, Alloc>::back() const {
+#ifndef MYSTL_VECTOR_UNCHECKED
     if(vec_size == 0) {
         throw std::out_of_range("Vector::back");
     }
-    return data[vec_size-1];
+#endif
+    return vec_data[vec_size-1];
 }
 
-// 交换函数实现
-template <typename T>
-void Vector<T>::swap(Vector& other) noexcept{
-    std::swap(data, other.data);
+// 交换函数实现，分配器不传播时要求两者相等
+template <typename T, typename Alloc>
+void Vector<T, Alloc>::swap(Vector& other) noexcept{
+    std::swap(vec_data, other.vec_data);
     std::swap(vec_size, other.vec_size);
     std::swap(vec_capacity, other.vec_capacity);
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+        std::swap(allocator, other.allocator);
+    }
+}
+
+// 分配器访问函数实现
+template <typename T, typename Alloc>
+typename Vector<T, Alloc>::allocator_type Vector<T, Alloc>::get_allocator() const noexcept {
+    return allocator;
 }
 
 // 输出流运算符实现
-template <typename T>
-std::ostream& operator<<(std::ostream& os, const Vector<T>& vec) {
+template <typename T, typename Alloc>
+std::ostream& operator<<(std::ostream& os, const Vector<T, Alloc>& vec) {
     for (size_t i = 0; i < vec.vec_size; ++i) {
-        os << vec.data[i] << " ";
+        os << vec.vec_data[i] << " ";
     }
     return os;
 }
 
 
-// 快速排序函数实现
-template <typename T>
+// 排序函数实现
+template <typename T, typename Alloc>
 template <typename Compare>
-void Vector<T>::quick_sort(iterator first, iterator last, Compare cmp) {
-    if (first >= last) return;
-    // 选择基准元素（此处选择中间元素）
-    T pivot = *(first + (last - first) / 2);
-    iterator left = first;
-    iterator right = last - 1;
-
-    // 分区操作
-    while (left <= right) {
-        while (cmp(*left, pivot)) ++left;
-        while (cmp(pivot, *right)) --right;
-        if (left <= right) {
-            std::swap(*left, *right);
-            ++left;
-            --right;
-        }
-    }
-    // 递归排序
-    quick_sort(first, right + 1, cmp);
-    quick_sort(left, last, cmp);
-}
-// 快速排序函数实现
-template <typename T>
+void Vector<T, Alloc>::sort(iterator first, iterator last, Compare cmp) {
+    sort_detail::pdqsort(first.operator->(), last.operator->(), cmp);
+}
+
+template <typename T, typename Alloc>
 template <typename Compare>
-void Vector<T>::sort(iterator first, iterator last, Compare cmp) {
-    quick_sort(first, last, cmp);
+void Vector<T, Alloc>::sort(Compare cmp) {
+    sort_detail::pdqsort(vec_data, vec_data + vec_size, cmp);
 }
 
-template <typename T>
+// 稳定排序函数实现
+template <typename T, typename Alloc>
+template <typename Compare>
+void Vector<T, Alloc>::stable_sort(iterator first, iterator last, Compare cmp) {
+    sort_detail::stable_sort(first.operator->(), last.operator->(), cmp);
+}
+
+template <typename T, typename Alloc>
 template <typename Compare>
-void Vector<T>::sort(Compare cmp) {
-    quick_sort(begin(), end(), cmp);
+void Vector<T, Alloc>::stable_sort(Compare cmp) {
+    sort_detail::stable_sort(vec_data, vec_data + vec_size, cmp);
 }
 
+// 基数排序函数实现
+template <typename T, typename Alloc>
+template <typename KeyFn>
+void Vector<T, Alloc>::radix_sort(KeyFn key) {
+    radix_detail::lsd_sort(vec_data, vec_data + vec_size, key);
+}
+
+template <typename T, typename Alloc>
+template <typename KeyFn>
+void Vector<T, Alloc>::msd_radix_sort(KeyFn key) {
+    radix_detail::msd_sort(vec_data, vec_data + vec_size, key);
+}
+
+// SmallVector：前 N 个元素存放在对象内部的缓冲区中，超出后透明地转移到堆上。
+// 接口与 Vector 保持一致（迭代器类型也相同），可以直接替换调用处的 Vector
+template <typename T, size_t N, typename Alloc = std::allocator<T>>
+class SmallVector {
+    static_assert(N > 0, "SmallVector 的内联容量必须大于 0");
+public:
+    using iterator = typename Vector<T, Alloc>::iterator;
+    using const_iterator = typename Vector<T, Alloc>::const_iterator;
+private:
+    using alloc_traits = std::allocator_traits<Alloc>;
+
+    T* vec_data;
+    size_t vec_size;
+    size_t vec_capacity;
+    [[no_unique_address]] Alloc allocator;
+    alignas(T) std::byte inline_buffer[N * sizeof(T)];
+
+    T* inline_data() noexcept { return reinterpret_cast<T*>(inline_buffer); }
+    [[nodiscard]] bool is_inline() const noexcept { return vec_data == reinterpret_cast<const T*>(inline_buffer); }
+    // 释放堆内存并回到内联缓冲区（元素必须已经销毁或搬走）
+    void reset_to_inline() noexcept;
+    // 下一次扩容的目标容量
+    [[nodiscard]] size_t next_capacity() const noexcept;
+    // 申请能容纳 n 个元素的堆内存，并记录分配统计
+    T* allocate_storage(size_t n);
+    // 换用新的堆内存：旧内存在堆上时释放（元素必须已经搬走或销毁）
+    void replace_storage(T* new_data, size_t new_capacity) noexcept;
+    // 容量已满时的插入
+    template<typename... Args>
+    void realloc_insert(size_t index, Args&&... args);
+    template<typename ForwardIt>
+    iterator insert_n(size_t index, ForwardIt first, size_t n);
+    template<typename ForwardIt>
+    void assign_n(ForwardIt first, size_t n);
+    // 接管或逐个移动 other 的元素，完成后 other 为空
+    void take_from(SmallVector& other);
+    // 分配器可能不相等时 take_from 需要申请内存，此时移动赋值不能声明为 noexcept
+    static constexpr bool nothrow_take = std::is_nothrow_move_constructible_v<T> &&
+        (alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value);
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    // 构造函数声明
+    SmallVector() noexcept(noexcept(Alloc()));
+    explicit SmallVector(const Alloc& alloc) noexcept;
+    explicit SmallVector(size_t n, const Alloc& alloc = Alloc());
+    SmallVector(size_t n, const T& val, const Alloc& alloc = Alloc());
+    SmallVector(std::initializer_list<T> init, const Alloc& alloc = Alloc());
+    SmallVector(const SmallVector& other);
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+    // 赋值运算符声明
+    SmallVector& operator=(const SmallVector& other);
+    SmallVector& operator=(SmallVector&& other) noexcept(nothrow_take);
+    // 析构函数声明
+    ~SmallVector();
+    // 迭代器函数声明
+    iterator begin();
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+    const_iterator const_begin() const;
+    iterator end();
+    const_iterator end() const;
+    const_iterator cend() const;
+    const_iterator const_end() const;
+    // 访问元素函数声明。operator[] 默认检查越界，定义 MYSTL_VECTOR_UNCHECKED 后不再检查，
+    // 热循环中没有了抛异常的分支，编译器可以自动向量化；at() 始终检查
+    T& operator[](size_t index);
+    const T& operator[](size_t index) const;
+    T& at(size_t index);
+    const T& at(size_t index) const;
+    // 底层连续存储的首地址
+    T* data() noexcept;
+    const T* data() const noexcept;
+    // 不检查越界的连续视图；容器本身也满足 contiguous_range，可以直接转换为 std::span
+    std::span<T> as_span() noexcept;
+    std::span<const T> as_span() const noexcept;
+    // 容量和大小函数声明
+    [[nodiscard]] size_t capacity() const;
+    void set_capacity(size_t new_capacity);
+    void reserve(size_t new_capacity);
+    // 元素个数不超过 N 时搬回内联缓冲区
+    void shrink_to_fit();
+    [[nodiscard]] bool empty() const;
+    [[nodiscard]] size_t size() const;
+    void resize(size_t n);
+    void resize(size_t n, const T& value);
+    void resize_for_overwrite(size_t n);
+    // 元素是否仍在内联缓冲区中
+    [[nodiscard]] bool is_small() const;
+    // 清空函数声明
+    void clear();
+    // 添加元素函数声明
+    void push_back(const T& value);
+    void push_back(T&& value);
+    template<typename... Args>
+    void emplace_back(Args&&... args);
+    // 查找元素函数声明（算术类型使用 SIMD 内核）
+    const_iterator find(const T& value) const;
+    [[nodiscard]] size_t count(const T& value) const;
+    [[nodiscard]] bool contains(const T& value) const;
+    // 查找第一个等于任一 key 的元素
+    const_iterator find_first_of(const T* keys, size_t key_count) const;
+    const_iterator find_first_of(std::initializer_list<T> keys) const;
+    // 按谓词查找/计数，谓词以 FunctionRef 传入，不为每个 lambda 实例化一份
+    const_iterator find_if(FunctionRef<bool(const T&)> pred) const;
+    [[nodiscard]] size_t count_if(FunctionRef<bool(const T&)> pred) const;
+    // 最小、最大元素，容器为空时返回 const_end()
+    const_iterator min_element() const;
+    const_iterator max_element() const;
+    // 插入元素函数声明，返回指向第一个新元素的迭代器
+    iterator insert(iterator pos, const T& value);
+    iterator insert(iterator pos, T&& value);
+    iterator insert(iterator pos, size_t n, const T& value);
+    // 区间插入：最多一次扩容、一次整体后移。区间不能来自本容器
+    template<vector_detail::iterator_like InputIt>
+    iterator insert(iterator pos, InputIt first, InputIt last);
+    iterator insert(iterator pos, std::initializer_list<T> init);
+    // 在指定位置直接构造元素
+    template<typename... Args>
+    iterator emplace(iterator pos, Args&&... args);
+    // 在末尾追加一个区间
+    template<vector_detail::iterator_like InputIt>
+    void append(InputIt first, InputIt last);
+    void append(std::initializer_list<T> init);
+    // 整体替换内容，容量足够时复用现有内存
+    void assign(size_t n, const T& value);
+    template<vector_detail::iterator_like InputIt>
+    void assign(InputIt first, InputIt last);
+    void assign(std::initializer_list<T> init);
+    // 删除元素函数声明，返回指向被删除元素之后元素的迭代器
+    iterator erase(iterator pos);
+    iterator erase(iterator first, iterator last);
+    void pop_back();
+    // 访问首尾元素函数声明
+    T& front() const;
+    T& back() const;
+    // 交换函数声明
+    void swap(SmallVector& other) noexcept(nothrow_take);
+    allocator_type get_allocator() const noexcept;
+    template <typename U, size_t M, typename A>
+    friend std::ostream& operator<<(std::ostream& os, const SmallVector<U, M, A>& vec);
+    // 排序函数声明
+    template<typename Compare = std::less<T>>
+    void sort(iterator first, iterator last, Compare cmp = Compare());
+    template<typename Compare = std::less<T>>
+    void sort(Compare cmp = Compare());
+    template<typename Compare = std::less<T>>
+    void stable_sort(iterator first, iterator last, Compare cmp = Compare());
+    template<typename Compare = std::less<T>>
+    void stable_sort(Compare cmp = Compare());
+    // 基数排序函数声明：key(element) 返回整数或浮点数，默认以元素本身为键。
+    // radix_sort 为稳定的 LSD 排序（需要 O(n) 额外空间），
+    // msd_radix_sort 为不稳定的原地 MSD 排序，键还可以是字节串（返回引用或 std::string_view）
+    template<typename KeyFn = radix_detail::identity_key>
+    void radix_sort(KeyFn key = KeyFn());
+    template<typename KeyFn = radix_detail::identity_key>
+    void msd_radix_sort(KeyFn key = KeyFn());
+};
+
+template <typename T, size_t N, typename Alloc>
+void SmallVector<T, N, Alloc>::reserve(size_t new_capacity) {
+    if (new_capacity <= vec_capacity) return;
+
+    T* new_data = allocate_storage(new_capacity);
+    try {
+        vector_detail::uninitialized_relocate(allocator, vec_data, vec_data + vec_size, new_data);
+    } catch (...) {
+        alloc_traits::deallocate(allocator, new_data, new_capacity);
+        throw;
+    }
+    replace_storage(new_data, new_capacity);
+}
+
+template <typename T, size_t N, typename Alloc>
+void SmallVector<T, N, Alloc>::reset_to_inline() noexcept {
+    if (!is_inline()) {
+        alloc_traits::deallocate(allocator, vec_data, vec_capacity);
+    }
+    vec_data = inline_data();
+    vec_capacity = N;
+}
+
+template <typename T, size_t N, typename Alloc>
+size_t SmallVector<T, N, Alloc>::next_capacity() const noexcept {
+    return 2 * vec_capacity;
+}
+
+template <typename T, size_t N, typename Alloc>
+T* SmallVector<T, N, Alloc>::allocate_storage(size_t n) {
+    T* p = alloc_traits::allocate(allocator, n);
+    // 已有元素需要搬到新内存时算作一次扩容
+    vector_telemetry::record_allocation<T>(n, vec_size > 0);
+    return p;
+}
+
+template <typename T, size_t N, typename Alloc>
+void SmallVector<T, N, Alloc>::replace_storage(T* new_data, size_t new_capacity) noexcept {
+    if (!is_inline()) {
+        alloc_traits::deallocate(allocator, vec_data, vec_capacity);
+    }
+    vec_data = new_data;
+    vec_capacity = new_capacity;
+}
+
+template <typename T, size_t N, typename Alloc>
+template <typename... Args>
+void SmallVector<T, N, Alloc>::realloc_insert(size_t index, Args&&... args) {
+    size_t new_capacity = next_capacity();
+    T* new_data = allocate_storage(new_capacity);
+    try {
+        vector_detail::relocate_with_insert(allocator, vec_data, vec_size, index, new_data, std::forward<Args>(args)...);
+    } catch (...) {
+        alloc_traits::deallocate(allocator, new_data, new_capacity);
+        throw;
+    }
+    replace_storage(new_data, new_capacity);
+    ++vec_size;
+}
+
+template <typename T, size_t N, typename Alloc>
+template <typename ForwardIt>
+typename SmallVector<T, N, Alloc>::iterator SmallVector<T, N, Alloc>::insert_n(size_t index, ForwardIt first, size_t n) {
+    if (n == 0) return iterator(vec_data + index);
+    if (n > vec_capacity - vec_size) {
+        size_t new_capacity = std::max(vec_size + n, next_capacity());
+        T* new_data = allocate_storage(new_capacity);
+        try {
+            vector_detail::relocate_with_gap(allocator, vec_data, vec_size, index, new_data, n, [&](T* dest) {
+                vector_detail::uninitialized_copy_n(allocator, first, n, dest);
+            });
+        } catch (...) {
+            alloc_traits::deallocate(allocator, new_data, new_capacity);
+            throw;
+        }
+        replace_storage(new_data, new_capacity);
+    } else {
+        vector_detail::insert_range_in_place(allocator, vec_data, vec_size, index, first, n);
+    }
+    vec_size += n;
+    return iterator(vec_data + index);
+}
+
+template <typename T, size_t N, typename Alloc>
+template <typename ForwardIt>
+void SmallVector<T, N, Alloc>::assign_n(ForwardIt first, size_t n) {
+    if (n > vec_capacity) {
+        // 先在新内存中构造好全部元素，再销毁旧内容
+        T* new_data = allocate_storage(n);
+        try {
+            vector_detail::uninitialized_copy_n(allocator, first, n, new_data);
+        } catch (...) {
+            alloc_traits::deallocate(allocator, new_data, n);
+            throw;
+        }
+        vector_detail::destroy(allocator, vec_data, vec_data + vec_size);
+        replace_storage(new_data, n);
+        vec_size = n;
+        return;
+    }
+    size_t common = std::min(n, vec_size);
+    for (size_t i = 0; i < common; ++i, ++first) {
+        vec_data[i] = *first;
+    }
+    if (n > vec_size) {
+        vector_detail::uninitialized_copy_n(allocator, first, n - vec_size, vec_data + vec_size);
+    } else {
+        vector_detail::destroy(allocator, vec_data + n, vec_data + vec_size);
+    }
+    vec_size = n;
+}
+
+template <typename T, size_t N, typename Alloc>
+void SmallVector<T, N, Alloc>::take_from(SmallVector& other) {
+    if (!other.is_inline() && (alloc_traits::is_always_equal::value || allocator == other.allocator)) {
+        // 对方在堆上：直接接管内存
+        vec_data = other.vec_data;
+        vec_size = other.vec_size;
+        vec_capacity = other.vec_capacity;
+        other.vec_data = other.inline_data();
+        other.vec_size = 0;
+        other.vec_capacity = N;
+        return;
+    }
+    // 对方在内联缓冲区中（或分配器不相等）：只能搬运元素
+    reserve(other.vec_size);
+    vector_detail::uninitialized_relocate(allocator, other.vec_data, other.vec_data + other.vec_size, vec_data);
+    vec_size = other.vec_size;
+    other.vec_size = 0;
+    other.reset_to_inline();
+}
+
+// 构造函数实现
+template <typename T, size_t N, typename Alloc>
+SmallVector<T, N, Alloc>::SmallVector() noexcept(noexcept(Alloc()))
+    : vec_data(inline_data()), vec_size(0), vec_capacity(N), allocator() {}
+
+template <typename T, size_t N, typename Alloc>
+SmallVector<T, N, Alloc>::SmallVector(const Alloc& alloc) noexcept
+    : vec_data(inline_data()), vec_size(0), vec_capacity(N), allocator(alloc) {}
+
+template <typename T, size_t N, typename Alloc>
+SmallVector<T, N, Alloc>::SmallVector(size_t n, const Alloc& alloc) : SmallVector(alloc) {
+    reserve(n);
+    for (; vec_size < n; ++vec_size) {
+        alloc_traits::construct(allocator, vec_data + vec_size);
+    }
+}
+
+template <typename T, size_t N, typename Alloc>
+SmallVector<T, N, Alloc>::SmallVector(size_t n, const T& val, const Alloc& alloc) : SmallVector(alloc) {
+    reserve(n);
+    for (; vec_size < n; ++vec_size) {
+        alloc_traits::construct(allocator, vec_data + vec_size, val);
+    }
+}
+
+template <typename T, size_t N, typename Alloc>
+SmallVector<T, N, Alloc>::SmallVector(std::initializer_list<T> init, const Alloc& alloc) : SmallVector(alloc) {
+    reserve(init.size());
+    for (const T& value : init) {
+        alloc_traits::construct(allocator, vec_data + vec_size, value);
+        ++vec_size;
+    }
+}
+
+template <typename T, size_t N, typename Alloc>
+SmallVector<T, N, Alloc>::SmallVector(const SmallVector& other)
+    : SmallVector(alloc_traits::select_on_container_copy_construction(other.allocator)) {
+    reserve(other.vec_size);
+    for (; vec_size < other.vec_size; ++vec_size) {
+        alloc_traits::construct(allocator, vec_data + vec_size, other.vec_data[vec_size]);
+    }
+    vector_telemetry::record_copied<T>(other.vec_size);
+}
+
+template <typename T, size_t N, typename Alloc>
+SmallVector<T, N, Alloc>::SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    : SmallVector(other.allocator) {
+    take_from(other);
+}
+
+// 赋值运算符实现
+template <typename T, size_t N, typename Alloc>
+SmallVector<T, N, Alloc>& SmallVector<T, N, Alloc>::operator=(const SmallVector& other) {
+    if (this != &other) {
+        clear();
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+            allocator = other.allocator;
+        }
+        reserve(other.vec_size);
+        for (; vec_size < other.vec_size; ++vec_size) {
+            alloc_traits::construct(allocator, vec_data + vec_size, other.vec_data[vec_size]);
+        }
+        vector_telemetry::record_copied<T>(other.vec_size);
+    }
+    return *this;
+}
+
+template <typename T, size_t N, typename Alloc>
+SmallVector<T, N, Alloc>& SmallVector<T, N, Alloc>::operator=(SmallVector&& other) noexcept(nothrow_take) {
+    if (this != &other) {
+        clear();
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+            allocator = std::move(other.allocator);
+        }
+        take_from(other);
+    }
+    return *this;
+}
+
+template <typename T, size_t N, typename Alloc>
+SmallVector<T, N, Alloc>::~SmallVector() {
+    clear();
+}
+
+// 迭代器函数实现
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::iterator SmallVector<T, N, Alloc>::begin() {
+    return iterator(vec_data);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::const_iterator SmallVector<T, N, Alloc>::begin() const {
+    return const_iterator(vec_data);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::const_iterator SmallVector<T, N, Alloc>::cbegin() const {
+    return const_iterator(vec_data);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::const_iterator SmallVector<T, N, Alloc>::const_begin() const {
+    return const_iterator(vec_data);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::iterator SmallVector<T, N, Alloc>::end() {
+    return iterator(vec_data + vec_size);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::const_iterator SmallVector<T, N, Alloc>::end() const {
+    return const_iterator(vec_data + vec_size);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::const_iterator SmallVector<T, N, Alloc>::cend() const {
+    return const_iterator(vec_data + vec_size);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::const_iterator SmallVector<T, N, Alloc>::const_end() const {
+    return const_iterator(vec_data + vec_size);
+}
+
+// 访问元素函数实现
+template <typename T, size_t N, typename Alloc>
+T& SmallVector<T, N, Alloc>::operator[](size_t index) {
+#ifndef MYSTL_VECTOR_UNCHECKED
+    if (index >= vec_size) {
+        throw std::out_of_range("SmallVector::operator[]");
+    }
+#endif
+    return vec_data[index];
+}
+
+template <typename T, size_t N, typename Alloc>
+const T& SmallVector<T, N, Alloc>::operator[](size_t index) const {
+#ifndef MYSTL_VECTOR_UNCHECKED
+    if (index >= vec_size) {
+        throw std::out_of_range("SmallVector::operator[]");
+    }
+#endif
+    return vec_data[index];
+}
+
+template <typename T, size_t N, typename Alloc>
+T& SmallVector<T, N, Alloc>::at(size_t index) {
+    if (index >= vec_size) {
+        throw std::out_of_range("SmallVector::at");
+    }
+    return vec_data[index];
+}
+
+template <typename T, size_t N, typename Alloc>
+const T& SmallVector<T, N, Alloc>::at(size_t index) const {
+    if (index >= vec_size) {
+        throw std::out_of_range("SmallVector::at");
+    }
+    return vec_data[index];
+}
+
+template <typename T, size_t N, typename Alloc>
+T* SmallVector<T, N, Alloc>::data() noexcept {
+    return vec_data;
+}
+
+template <typename T, size_t N, typename Alloc>
+const T* SmallVector<T, N, Alloc>::data() const noexcept {
+    return vec_data;
+}
+
+template <typename T, size_t N, typename Alloc>
+std::span<T> SmallVector<T, N, Alloc>::as_span() noexcept {
+    return std::span<T>(vec_data, vec_size);
+}
+
+template <typename T, size_t N, typename Alloc>
+std::span<const T> SmallVector<T, N, Alloc>::as_span() const noexcept {
+    return std::span<const T>(vec_data, vec_size);
+}
+
+// 容量和大小函数实现
+template <typename T, size_t N, typename Alloc>
+size_t SmallVector<T, N, Alloc>::capacity() const {
+    return vec_capacity;
+}
+
+template <typename T, size_t N, typename Alloc>
+void SmallVector<T, N, Alloc>::set_capacity(size_t new_capacity) {
+    reserve(new_capacity);
+}
+
+template <typename T, size_t N, typename Alloc>
+bool SmallVector<T, N, Alloc>::empty() const {
+    return vec_size == 0;
+}
+
+template <typename T, size_t N, typename Alloc>
+size_t SmallVector<T, N, Alloc>::size() const {
+    return vec_size;
+}
+
+template <typename T, size_t N, typename Alloc>
+void SmallVector<T, N, Alloc>::shrink_to_fit() {
+    if (is_inline() || vec_size == vec_capacity) return;
+    if (vec_size <= N) {
+        // 搬回内联缓冲区
+        T* heap_data = vec_data;
+        size_t heap_capacity = vec_capacity;
+        vector_detail::uninitialized_relocate(allocator, heap_data, heap_data + vec_size, inline_data());
+        vec_data = inline_data();
+        vec_capacity = N;
+        alloc_traits::deallocate(allocator, heap_data, heap_capacity);
+        return;
+    }
+    T* new_data = allocate_storage(vec_size);
+    try {
+        vector_detail::uninitialized_relocate(allocator, vec_data, vec_data + vec_size, new_data);
+    } catch (...) {
+        alloc_traits::deallocate(allocator, new_data, vec_size);
+        throw;
+    }
+    replace_storage(new_data, vec_size);
+}
+
+template <typename T, size_t N, typename Alloc>
+void SmallVector<T, N, Alloc>::resize(size_t n) {
+    if (n <= vec_size) {
+        vector_detail::destroy(allocator, vec_data + n, vec_data + vec_size);
+    } else {
+        if (n > vec_capacity) {
+            reserve(std::max(n, next_capacity()));
+        }
+        vector_detail::uninitialized_value_construct_n(allocator, vec_data + vec_size, n - vec_size);
+    }
+    vec_size = n;
+}
+
+template <typename T, size_t N, typename Alloc>
+void SmallVector<T, N, Alloc>::resize(size_t n, const T& value) {
+    if (n <= vec_size) {
+        vector_detail::destroy(allocator, vec_data + n, vec_data + vec_size);
+        vec_size = n;
+        return;
+    }
+    // value 可能引用扩容时被搬走的元素，先复制一份
+    T tmp(value);
+    if (n > vec_capacity) {
+        reserve(std::max(n, next_capacity()));
+    }
+    vector_detail::uninitialized_copy_n(allocator, vector_detail::repeat_iterator<T>(&tmp, 0), n - vec_size, vec_data + vec_size);
+    vec_size = n;
+}
+
+template <typename T, size_t N, typename Alloc>
+void SmallVector<T, N, Alloc>::resize_for_overwrite(size_t n) {
+    if (n <= vec_size) {
+        vector_detail::destroy(allocator, vec_data + n, vec_data + vec_size);
+    } else {
+        if (n > vec_capacity) {
+            reserve(std::max(n, next_capacity()));
+        }
+        vector_detail::uninitialized_default_construct_n(allocator, vec_data + vec_size, n - vec_size);
+    }
+    vec_size = n;
+}
+
+template <typename T, size_t N, typename Alloc>
+bool SmallVector<T, N, Alloc>::is_small() const {
+    return is_inline();
+}
+
+// 清空函数实现，与 Vector 一致会释放堆内存
+template <typename T, size_t N, typename Alloc>
+void SmallVector<T, N, Alloc>::clear() {
+    vector_detail::destroy(allocator, vec_data, vec_data + vec_size);
+    vec_size = 0;
+    reset_to_inline();
+}
+
+// 添加元素函数实现
+template <typename T, size_t N, typename Alloc>
+void SmallVector<T, N, Alloc>::push_back(const T& value) {
+    emplace_back(value);
+    vector_telemetry::record_copied<T>(1);
+}
+
+template <typename T, size_t N, typename Alloc>
+void SmallVector<T, N, Alloc>::push_back(T&& value) {
+    emplace_back(std::move(value));
+}
+
+template <typename T, size_t N, typename Alloc>
+template <typename... Args>
+void SmallVector<T, N, Alloc>::emplace_back(Args&&... args) {
+    if (vec_size == vec_capacity) {
+        realloc_insert(vec_size, std::forward<Args>(args)...);
+        return;
+    }
+    alloc_traits::construct(allocator, vec_data + vec_size, std::forward<Args>(args)...);
+    ++vec_size;
+}
+
+// 查找元素函数实现
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::const_iterator SmallVector<T, N, Alloc>::find(const T& value) const {
+    return const_iterator(vector_detail::find<T>(vec_data, vec_data + vec_size, value));
+}
+
+template <typename T, size_t N, typename Alloc>
+size_t SmallVector<T, N, Alloc>::count(const T& value) const {
+    return vector_detail::count<T>(vec_data, vec_data + vec_size, value);
+}
+
+template <typename T, size_t N, typename Alloc>
+bool SmallVector<T, N, Alloc>::contains(const T& value) const {
+    return vector_detail::find<T>(vec_data, vec_data + vec_size, value) != vec_data + vec_size;
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::const_iterator SmallVector<T, N, Alloc>::find_first_of(const T* keys, size_t key_count) const {
+    return const_iterator(vector_detail::find_first_of<T>(vec_data, vec_data + vec_size, keys, key_count));
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::const_iterator SmallVector<T, N, Alloc>::find_first_of(std::initializer_list<T> keys) const {
+    return find_first_of(keys.begin(), keys.size());
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::const_iterator SmallVector<T, N, Alloc>::find_if(FunctionRef<bool(const T&)> pred) const {
+    for (size_t i = 0; i < vec_size; ++i) {
+        if (pred(vec_data[i])) return const_iterator(vec_data + i);
+    }
+    return const_end();
+}
+
+template <typename T, size_t N, typename Alloc>
+size_t SmallVector<T, N, Alloc>::count_if(FunctionRef<bool(const T&)> pred) const {
+    size_t n = 0;
+    for (size_t i = 0; i < vec_size; ++i) {
+        n += pred(vec_data[i]) ? 1 : 0;
+    }
+    return n;
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::const_iterator SmallVector<T, N, Alloc>::min_element() const {
+    return const_iterator(vector_detail::min_element<T>(vec_data, vec_data + vec_size));
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::const_iterator SmallVector<T, N, Alloc>::max_element() const {
+    return const_iterator(vector_detail::max_element<T>(vec_data, vec_data + vec_size));
+}
+
+// 插入、删除元素函数实现
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::iterator SmallVector<T, N, Alloc>::insert(iterator pos, const T& value) {
+    return emplace(pos, value);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::iterator SmallVector<T, N, Alloc>::insert(iterator pos, T&& value) {
+    return emplace(pos, std::move(value));
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::iterator SmallVector<T, N, Alloc>::insert(iterator pos, size_t n, const T& value) {
+    // value 可能引用即将被移动的元素，先复制一份
+    T tmp(value);
+    return insert_n(pos - begin(), vector_detail::repeat_iterator<T>(&tmp, 0), n);
+}
+
+template <typename T, size_t N, typename Alloc>
+template <vector_detail::iterator_like InputIt>
+typename SmallVector<T, N, Alloc>::iterator SmallVector<T, N, Alloc>::insert(iterator pos, InputIt first, InputIt last) {
+    size_t index = pos - begin();
+    if constexpr (vector_detail::multipass_iterator<InputIt>) {
+        return insert_n(index, first, static_cast<size_t>(std::distance(first, last)));
+    } else {
+        // 单遍迭代器无法预先求出长度：先追加到末尾，再整体旋转到插入位置
+        size_t old_size = vec_size;
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+        std::rotate(vec_data + index, vec_data + old_size, vec_data + vec_size);
+        return iterator(vec_data + index);
+    }
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::iterator SmallVector<T, N, Alloc>::insert(iterator pos, std::initializer_list<T> init) {
+    return insert_n(pos - begin(), init.begin(), init.size());
+}
+
+template <typename T, size_t N, typename Alloc>
+template <typename... Args>
+typename SmallVector<T, N, Alloc>::iterator SmallVector<T, N, Alloc>::emplace(iterator pos, Args&&... args) {
+    size_t index = pos - begin();
+    if (vec_size == vec_capacity) {
+        realloc_insert(index, std::forward<Args>(args)...);
+    } else if (index == vec_size) {
+        alloc_traits::construct(allocator, vec_data + vec_size, std::forward<Args>(args)...);
+        ++vec_size;
+    } else {
+        // 先构造临时对象：参数可能引用即将被移动的元素
+        T tmp(std::forward<Args>(args)...);
+        vector_detail::insert_in_place(allocator, vec_data, vec_size, index, tmp);
+        ++vec_size;
+    }
+    return iterator(vec_data + index);
+}
+
+template <typename T, size_t N, typename Alloc>
+template <vector_detail::iterator_like InputIt>
+void SmallVector<T, N, Alloc>::append(InputIt first, InputIt last) {
+    insert(end(), first, last);
+}
+
+template <typename T, size_t N, typename Alloc>
+void SmallVector<T, N, Alloc>::append(std::initializer_list<T> init) {
+    insert_n(vec_size, init.begin(), init.size());
+}
+
+template <typename T, size_t N, typename Alloc>
+void SmallVector<T, N, Alloc>::assign(size_t n, const T& value) {
+    T tmp(value);
+    assign_n(vector_detail::repeat_iterator<T>(&tmp, 0), n);
+}
+
+template <typename T, size_t N, typename Alloc>
+template <vector_detail::iterator_like InputIt>
+void SmallVector<T, N, Alloc>::assign(InputIt first, InputIt last) {
+    if constexpr (vector_detail::multipass_iterator<InputIt>) {
+        assign_n(first, static_cast<size_t>(std::distance(first, last)));
+    } else {
+        vector_detail::destroy(allocator, vec_data, vec_data + vec_size);
+        vec_size = 0;
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+}
+
+template <typename T, size_t N, typename Alloc>
+void SmallVector<T, N, Alloc>::assign(std::initializer_list<T> init) {
+    assign_n(init.begin(), init.size());
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::iterator SmallVector<T, N, Alloc>::erase(iterator pos) {
+    return erase(pos, pos + 1);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::iterator SmallVector<T, N, Alloc>::erase(iterator first, iterator last) {
+    size_t index = first - begin();
+    size_t n = last - first;
+    vector_detail::erase_range_in_place(allocator, vec_data, vec_size, index, n);
+    vec_size -= n;
+    return iterator(vec_data + index);
+}
+
+template <typename T, size_t N, typename Alloc>
+void SmallVector<T, N, Alloc>::pop_back() {
+    if (vec_size == 0) {
+        throw std::out_of_range("SmallVector::pop_back");
+    }
+    alloc_traits::destroy(allocator, vec_data + vec_size - 1);
+    --vec_size;
+}
+
+// 访问首尾元素函数实现
+template <typename T, size_t N, typename Alloc>
+T& SmallVector<T, N, Alloc>::front() const {
+#ifndef MYSTL_VECTOR_UNCHECKED
+    if (vec_size == 0) {
+        throw std::out_of_range("SmallVector::front");
+    }
+#endif
+    return vec_data[0];
+}
+
+template <typename T, size_t N, typename Alloc>
+T& SmallVector<T, N, Alloc>::back() const {
+#ifndef MYSTL_VECTOR_UNCHECKED
+    if (vec_size == 0) {
+        throw std::out_of_range("SmallVector::back");
+    }
+#endif
+    return vec_data[vec_size - 1];
+}
+
+// 交换函数实现：两边都在堆上时只交换指针，否则借助临时对象搬运元素
+template <typename T, size_t N, typename Alloc>
+void SmallVector<T, N, Alloc>::swap(SmallVector& other) noexcept(nothrow_take) {
+    if (this == &other) return;
+    if (!is_inline() && !other.is_inline()) {
+        std::swap(vec_data, other.vec_data);
+        std::swap(vec_size, other.vec_size);
+        std::swap(vec_capacity, other.vec_capacity);
+        if constexpr (alloc_traits::propagate_on_container_swap::value) {
+            std::swap(allocator, other.allocator);
+        }
+        return;
+    }
+    SmallVector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename SmallVector<T, N, Alloc>::allocator_type SmallVector<T, N, Alloc>::get_allocator() const noexcept {
+    return allocator;
+}
+
+// 输出流运算符实现
+template <typename T, size_t N, typename Alloc>
+std::ostream& operator<<(std::ostream& os, const SmallVector<T, N, Alloc>& vec) {
+    for (size_t i = 0; i < vec.vec_size; ++i) {
+        os << vec.vec_data[i] << " ";
+    }
+    return os;
+}
+
+// 排序函数实现
+template <typename T, size_t N, typename Alloc>
+template <typename Compare>
+void SmallVector<T, N, Alloc>::sort(iterator first, iterator last, Compare cmp) {
+    sort_detail::pdqsort(first.operator->(), last.operator->(), cmp);
+}
+
+template <typename T, size_t N, typename Alloc>
+template <typename Compare>
+void SmallVector<T, N, Alloc>::sort(Compare cmp) {
+    sort_detail::pdqsort(vec_data, vec_data + vec_size, cmp);
+}
+
+// 稳定排序函数实现
+template <typename T, size_t N, typename Alloc>
+template <typename Compare>
+void SmallVector<T, N, Alloc>::stable_sort(iterator first, iterator last, Compare cmp) {
+    sort_detail::stable_sort(first.operator->(), last.operator->(), cmp);
+}
+
+template <typename T, size_t N, typename Alloc>
+template <typename Compare>
+void SmallVector<T, N, Alloc>::stable_sort(Compare cmp) {
+    sort_detail::stable_sort(vec_data, vec_data + vec_size, cmp);
+}
+
+// 基数排序函数实现
+template <typename T, size_t N, typename Alloc>
+template <typename KeyFn>
+void SmallVector<T, N, Alloc>::radix_sort(KeyFn key) {
+    radix_detail::lsd_sort(vec_data, vec_data + vec_size, key);
+}
+
+template <typename T, size_t N, typename Alloc>
+template <typename KeyFn>
+void SmallVector<T, N, Alloc>::msd_radix_sort(KeyFn key) {
+    radix_detail::msd_sort(vec_data, vec_data + vec_size, key);
+}
+
+static_assert(std::contiguous_iterator<Vector<int>::iterator>);
+static_assert(std::contiguous_iterator<Vector<int>::const_iterator>);
+static_assert(std::ranges::contiguous_range<Vector<int>>);
+static_assert(std::ranges::contiguous_range<const SmallVector<int, 4>>);
+
 #endif // VECTOR_H
@@ -0,0 +1,148 @@
+#ifndef VECTOR_TELEMETRY_H
+#define VECTOR_TELEMETRY_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+// Vector 系列容器的统计插桩。定义 MYSTL_VECTOR_TELEMETRY 后，按元素类型累计
+// 分配次数、分配字节数、扩容次数、移动/拷贝的元素个数和峰值容量，可以遍历或导出为 JSON；
+// 未定义时所有 record_* 都是空的内联函数，不产生任何代码和静态数据
+namespace vector_telemetry {
+
+#ifdef MYSTL_VECTOR_TELEMETRY
+inline constexpr bool enabled = true;
+#else
+inline constexpr bool enabled = false;
+#endif
+
+// 单个元素类型的计数器。计数器之间没有顺序要求，全部使用 relaxed 原子操作
+struct Counters {
+    const std::type_info* type;
+    size_t element_size;
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> bytes_allocated{0};
+    std::atomic<uint64_t> reallocations{0};
+    std::atomic<uint64_t> elements_moved{0};
+    std::atomic<uint64_t> elements_copied{0};
+    std::atomic<uint64_t> peak_capacity{0};
+    Counters* next = nullptr;
+
+    Counters(const std::type_info* type, size_t element_size) noexcept;
+};
+
+// 全局注册表：各类型的计数器在第一次使用时挂到这条只增不减的链表上
+inline std::atomic<Counters*> registry_head{nullptr};
+
+inline Counters::Counters(const std::type_info* type, size_t element_size) noexcept
+    : type(type), element_size(element_size) {
+    Counters* head = registry_head.load(std::memory_order_relaxed);
+    do {
+        next = head;
+    } while (!registry_head.compare_exchange_weak(head, this, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template <typename T>
+Counters& counters_for() noexcept {
+    static Counters counters(&typeid(T), sizeof(T));
+    return counters;
+}
+
+// 插桩入口：容器在分配内存、搬运和拷贝元素时调用
+template <typename T>
+inline void record_allocation(size_t capacity, bool reallocation) noexcept {
+    if constexpr (enabled) {
+        Counters& c = counters_for<T>();
+        c.allocations.fetch_add(1, std::memory_order_relaxed);
+        c.bytes_allocated.fetch_add(capacity * sizeof(T), std::memory_order_relaxed);
+        if (reallocation) {
+            c.reallocations.fetch_add(1, std::memory_order_relaxed);
+        }
+        uint64_t peak = c.peak_capacity.load(std::memory_order_relaxed);
+        while (peak < capacity &&
+               !c.peak_capacity.compare_exchange_weak(peak, capacity, std::memory_order_relaxed)) {
+        }
+    }
+}
+
+template <typename T>
+inline void record_moved(size_t n) noexcept {
+    if constexpr (enabled) {
+        if (n) counters_for<T>().elements_moved.fetch_add(n, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+inline void record_copied(size_t n) noexcept {
+    if constexpr (enabled) {
+        if (n) counters_for<T>().elements_copied.fetch_add(n, std::memory_order_relaxed);
+    }
+}
+
+// 可读的类型名，GCC/Clang 下做 demangle
+inline std::string type_name(const std::type_info& type) {
+#if defined(__GNUG__)
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+    if (status == 0 && demangled) {
+        std::string name(demangled);
+        std::free(demangled);
+        return name;
+    }
+#endif
+    return type.name();
+}
+
+// 遍历所有已注册类型的计数器
+template <typename F>
+void for_each(F&& f) {
+    for (Counters* c = registry_head.load(std::memory_order_acquire); c; c = c->next) {
+        f(static_cast<const Counters&>(*c));
+    }
+}
+
+// 清零所有计数器（注册表本身保留）
+inline void reset() noexcept {
+    for (Counters* c = registry_head.load(std::memory_order_acquire); c; c = c->next) {
+        c->allocations.store(0, std::memory_order_relaxed);
+        c->bytes_allocated.store(0, std::memory_order_relaxed);
+        c->reallocations.store(0, std::memory_order_relaxed);
+        c->elements_moved.store(0, std::memory_order_relaxed);
+        c->elements_copied.store(0, std::memory_order_relaxed);
+        c->peak_capacity.store(0, std::memory_order_relaxed);
+    }
+}
+
+// 以 JSON 数组导出，每个元素类型一个对象；未开启统计时输出 []
+inline void dump_json(std::ostream& os) {
+    os << '[';
+    bool first = true;
+    for_each([&](const Counters& c) {
+        if (!first) os << ',';
+        first = false;
+        os << "{\"type\":\"";
+        for (char ch : type_name(*c.type)) {
+            if (ch == '"' || ch == '\\') os << '\\';
+            os << ch;
+        }
+        os << "\",\"element_size\":" << c.element_size
+           << ",\"allocations\":" << c.allocations.load(std::memory_order_relaxed)
+           << ",\"bytes_allocated\":" << c.bytes_allocated.load(std::memory_order_relaxed)
+           << ",\"reallocations\":" << c.reallocations.load(std::memory_order_relaxed)
+           << ",\"elements_moved\":" << c.elements_moved.load(std::memory_order_relaxed)
+           << ",\"elements_copied\":" << c.elements_copied.load(std::memory_order_relaxed)
+           << ",\"peak_capacity\":" << c.peak_capacity.load(std::memory_order_relaxed) << '}';
+    });
+    os << ']';
+}
+
+} // namespace vector_telemetry
+
+#endif // VECTOR_TELEMETRY_H